@@ -0,0 +1,144 @@
+/**
+ * ButtonDebounce - Engine Benchmark
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * Cost of ButtonDebounce::update() and ButtonBank::update() (dense, and
+ * with setSkipSettled) for the engine this binary is linked against.
+ * CMake builds one copy per engine (bench_integrator, bench_consecutive,
+ * ...) so engines can be compared side by side on the same host.
+ *
+ * Patterns:
+ * - idle:   line never changes
+ * - clean:  square wave, 40 ticks per level, no bounce
+ * - bouncy: square wave with 6 ticks of random chatter after each edge
+ * - noise:  independent random samples every tick
+ *
+ * With BUTTON_DEBOUNCE_PROFILE_* defined (CMake: -DBUTTON_DEBOUNCE_PROFILE=ON)
+ * the per-call cycle min/mean/max from the profiling hooks is printed too.
+ */
+
+#include "ButtonDebounce.h"
+#include "ButtonDebounceBank.h"
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+
+#ifndef BENCH_ENGINE_NAME
+#define BENCH_ENGINE_NAME "unknown"
+#endif
+
+static const size_t kButtons = 64;
+static const size_t kTicks   = 1u << 16;
+
+enum Pattern { Idle, Clean, Bouncy, Noise, PatternCount };
+static const char* const kPatternName[PatternCount] = { "idle", "clean", "bouncy", "noise" };
+
+static uint32_t lcg(uint32_t& s)
+{
+    s = s * 1664525u + 1013904223u;
+    return s >> 16;
+}
+
+// Raw sample for button b at tick t; each button is phase-shifted
+static std::vector<uint8_t> makePattern(Pattern p)
+{
+    std::vector<uint8_t> v(kTicks * kButtons);
+    uint32_t seed = 12345u;
+
+    for (size_t b = 0; b < kButtons; b++) {
+        for (size_t t = 0; t < kTicks; t++) {
+            const size_t ph = t + b * 7u;
+            const bool level = ((ph / 40u) & 1u) != 0u;
+            bool raw = false;
+
+            switch (p) {
+                case Idle:   raw = false; break;
+                case Clean:  raw = level; break;
+                case Bouncy: raw = ((ph % 40u) < 6u) ? ((lcg(seed) & 1u) != 0u) : level; break;
+                case Noise:  raw = (lcg(seed) & 1u) != 0u; break;
+                default: break;
+            }
+            v[t * kButtons + b] = raw ? 1u : 0u;
+        }
+    }
+    return v;
+}
+
+static volatile uint32_t g_sink;
+
+static double benchSingle(const std::vector<uint8_t>& raw)
+{
+    ButtonDebounce btn[kButtons];
+    uint32_t events = 0u;
+
+    const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    for (size_t t = 0; t < kTicks; t++) {
+        const uint8_t* s = &raw[t * kButtons];
+        for (size_t b = 0; b < kButtons; b++) {
+            btn[b].update(s[b] != 0u);
+            events += btn[b].pressed();
+        }
+    }
+    const std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+
+    g_sink = events;
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / (double)(kTicks * kButtons);
+}
+
+static double benchBank(const std::vector<uint8_t>& raw, bool skip_settled)
+{
+    static ButtonBank<kButtons> bank;
+    bank.reset();
+    bank.setSkipSettled(skip_settled);
+    std::vector<uint32_t> words(kTicks * ButtonBank<kButtons>::kWords, 0u);
+    for (size_t t = 0; t < kTicks; t++) {
+        for (size_t b = 0; b < kButtons; b++) {
+            words[t * ButtonBank<kButtons>::kWords + (b >> 5)] |= (uint32_t)raw[t * kButtons + b] << (b & 31u);
+        }
+    }
+
+    uint32_t events = 0u;
+    const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    for (size_t t = 0; t < kTicks; t++) {
+        bank.update(&words[t * ButtonBank<kButtons>::kWords]);
+        events += bank.pressedMask()[0];
+    }
+    const std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+
+    g_sink = events;
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / (double)(kTicks * kButtons);
+}
+
+int main()
+{
+    printf("engine: %s\n", BENCH_ENGINE_NAME);
+#if defined(BUTTON_DEBOUNCE_PROFILE)
+    printf("%-8s %14s %14s %14s %24s\n", "pattern", "update ns", "bank ns/btn", "skip ns/btn",
+           "update cyc min/mean/max");
+#else
+    printf("%-8s %14s %14s %14s\n", "pattern", "update ns", "bank ns/btn", "skip ns/btn");
+#endif
+
+    for (int p = 0; p < PatternCount; p++) {
+        const std::vector<uint8_t> raw = makePattern((Pattern)p);
+#if defined(BUTTON_DEBOUNCE_PROFILE)
+        ButtonDebounce::profile().reset();
+#endif
+        const double single = benchSingle(raw);
+#if defined(BUTTON_DEBOUNCE_PROFILE)
+        const ProfileStats prof = ButtonDebounce::profile();
+#endif
+        const double bank = benchBank(raw, false);
+        const double skip = benchBank(raw, true);
+#if defined(BUTTON_DEBOUNCE_PROFILE)
+        printf("%-8s %14.3f %14.3f %14.3f %10lu/%lu/%lu\n", kPatternName[p], single, bank, skip,
+               (unsigned long)prof.min, (unsigned long)prof.mean(), (unsigned long)prof.max);
+#else
+        printf("%-8s %14.3f %14.3f %14.3f\n", kPatternName[p], single, bank, skip);
+#endif
+    }
+    return 0;
+}
@@ -0,0 +1,99 @@
+/**
+ * ButtonDebounce - Impulse Noise Benchmark
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * Filtering quality and cost of the engine this binary is linked against
+ * on a slow square wave hit by single-tick impulses (samples inverted at
+ * random). CMake builds one copy per engine (bench_impulse_median,
+ * bench_impulse_consecutive, ...).
+ *
+ * Columns per impulse rate:
+ * - ns:      time per update()
+ * - extra:   events that do not belong to a true edge (glitch presses
+ *            and the releases that undo them)
+ * - missed:  true edges with no matching event before the next edge
+ * - latency: mean ticks from a true edge to its event
+ */
+
+#include "ButtonDebounce.h"
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+
+#ifndef BENCH_ENGINE_NAME
+#define BENCH_ENGINE_NAME "unknown"
+#endif
+
+static const size_t kTicks  = 1u << 20;
+static const size_t kPeriod = 100u;   // ticks per level of the clean signal
+
+static const unsigned kRatePct[] = { 1u, 5u, 10u, 20u };
+
+static uint32_t lcg(uint32_t& s)
+{
+    s = s * 1664525u + 1013904223u;
+    return s >> 16;
+}
+
+static volatile uint32_t g_sink;
+
+int main()
+{
+    printf("engine: %s\n", BENCH_ENGINE_NAME);
+    printf("%-8s %10s %10s %10s %10s\n", "impulse", "ns", "extra", "missed", "latency");
+
+    for (size_t r = 0; r < sizeof(kRatePct) / sizeof(kRatePct[0]); r++) {
+        std::vector<uint8_t> raw(kTicks);
+        uint32_t seed = 777u;
+        for (size_t t = 0; t < kTicks; t++) {
+            const bool level = ((t / kPeriod) & 1u) != 0u;
+            const bool hit = (lcg(seed) % 100u) < kRatePct[r];
+            raw[t] = (level != hit) ? 1u : 0u;
+        }
+
+        // Timing pass
+        ButtonDebounce timed;
+        uint32_t sink = 0u;
+        const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+        for (size_t t = 0; t < kTicks; t++) {
+            timed.update(raw[t] != 0u);
+            sink += timed.pressed();
+        }
+        const std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+        g_sink = sink;
+
+        // Quality pass
+        ButtonDebounce btn;
+        size_t events = 0, missed = 0, matched = 0, latency = 0;
+        bool seen = true;   // event seen for the current true edge
+        for (size_t t = 0; t < kTicks; t++) {
+            if (t % kPeriod == 0u && t != 0u) {
+                if (!seen) missed++;
+                seen = false;
+            }
+            btn.update(raw[t] != 0u);
+
+            const bool want = ((t / kPeriod) & 1u) != 0u;
+            if (btn.pressed() || btn.released()) {
+                events++;
+                if (!seen && btn.down() == want) {
+                    seen = true;
+                    matched++;
+                    latency += t % kPeriod;
+                }
+            }
+        }
+
+        const size_t extra = events - matched;
+        char label[16];
+        snprintf(label, sizeof(label), "%u%%", kRatePct[r]);
+        printf("%-8s %10.3f %10lu %10lu %10.2f\n", label,
+               std::chrono::duration<double, std::nano>(t1 - t0).count() / (double)kTicks,
+               (unsigned long)extra, (unsigned long)missed,
+               matched ? (double)latency / (double)matched : 0.0);
+    }
+    return 0;
+}
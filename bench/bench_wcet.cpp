@@ -0,0 +1,213 @@
+/**
+ * ButtonDebounce - Execution Time Variance Benchmark
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * Times ButtonDebounce::update() over fixed input patterns and reports
+ * how much the cost per call depends on the input. CMake builds it
+ * against the normal and the constant-time (BUTTON_DEBOUNCE_CONSTANT_TIME)
+ * library of each engine, e.g. bench_wcet_edgegated vs
+ * bench_wcet_edgegated_ct.
+ *
+ * Patterns:
+ * - low:     line held up
+ * - high:    line held down
+ * - clean:   square wave, 40 ticks per level, no bounce
+ * - bouncy:  square wave with 6 ticks of random chatter after each edge
+ * - chatter: line toggles every tick (edge-gated timeout / recenter path)
+ * - noise:   independent random samples every tick
+ *
+ * Each pattern is generated up front and replayed kPasses times. One
+ * stamp pair brackets a batch of kBatch consecutive calls, so the timer
+ * cost and resolution are spread over the batch; a single call is only
+ * a few cycles, below what rdtsc can resolve on its own.
+ *
+ * Output per pattern, in cycles (or ns) per call: mean, standard
+ * deviation, min and 99th percentile over the batches. Mean and stddev
+ * exclude the batches above the 99th percentile. The last two lines are
+ * the spread (max - min) of the per-pattern means and mins. On a desktop
+ * OS the means move by several cycles from run to run (interrupts, other
+ * load, frequency changes), even for a constant-time build; the min is
+ * the least disturbed figure, and its spread is the one to compare
+ * between the normal and constant-time build of an engine.
+ *
+ * Notes:
+ *  - Cycles come from rdtsc (fenced) on x86, nanoseconds from
+ *    steady_clock elsewhere. Per-call WCET on the target is better
+ *    measured with DWT, see ButtonDebounceProfile.h.
+ *  - The max is dominated by interrupts on a desktop OS, so the
+ *    99th percentile is reported in its place.
+ */
+
+#include "ButtonDebounce.h"
+#include <algorithm>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define BENCH_UNIT "cyc"
+static inline uint64_t stamp()
+{
+    _mm_lfence();
+    const uint64_t t = __rdtsc();
+    _mm_lfence();
+    return t;
+}
+#else
+#define BENCH_UNIT "ns"
+static inline uint64_t stamp()
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+#endif
+
+#ifndef BENCH_ENGINE_NAME
+#define BENCH_ENGINE_NAME "unknown"
+#endif
+
+static const size_t kTicks  = 1u << 18;   // pattern length
+static const size_t kBatch  = 1024u;      // calls per stamp pair
+static const size_t kPasses = 16u;        // replays of each pattern
+
+enum Pattern { Low, High, Clean, Bouncy, Chatter, Noise, PatternCount };
+static const char* const kPatternName[PatternCount] = {
+    "low", "high", "clean", "bouncy", "chatter", "noise"
+};
+
+static uint32_t lcg(uint32_t& s)
+{
+    s = s * 1664525u + 1013904223u;
+    return s >> 16;
+}
+
+static std::vector<uint8_t> makePattern(Pattern p)
+{
+    std::vector<uint8_t> v(kTicks);
+    uint32_t seed = 12345u;
+
+    for (size_t t = 0; t < kTicks; t++) {
+        const bool level = ((t / 40u) & 1u) != 0u;
+        bool raw = false;
+
+        switch (p) {
+            case Low:     raw = false; break;
+            case High:    raw = true; break;
+            case Clean:   raw = level; break;
+            case Bouncy:  raw = ((t % 40u) < 6u) ? ((lcg(seed) & 1u) != 0u) : level; break;
+            case Chatter: raw = (t & 1u) != 0u; break;
+            case Noise:   raw = (lcg(seed) & 1u) != 0u; break;
+            default: break;
+        }
+        v[t] = raw ? 1u : 0u;
+    }
+    return v;
+}
+
+// Per call, over the batches
+struct Result {
+    double mean;
+    double stddev;
+    double min;
+    double p99;
+};
+
+static volatile uint32_t g_sink;
+
+static Result summarize(std::vector<uint64_t>& batches, uint64_t overhead)
+{
+    Result r;
+
+    for (size_t i = 0; i < batches.size(); i++) {
+        batches[i] = batches[i] > overhead ? batches[i] - overhead : 0u;
+    }
+    std::sort(batches.begin(), batches.end());
+    const uint64_t p99 = batches[batches.size() - batches.size() / 100u - 1u];
+
+    // Mean / stddev over the batches up to p99 (drops interrupt outliers)
+    double sum = 0.0;
+    double sq = 0.0;
+    size_t n = 0;
+    for (; n < batches.size() && batches[n] <= p99; n++) {
+        const double c = (double)batches[n] / (double)kBatch;
+        sum += c;
+        sq  += c * c;
+    }
+    r.mean = sum / (double)n;
+    r.stddev = sqrt(std::max(0.0, sq / (double)n - r.mean * r.mean));
+    r.min = (double)batches.front() / (double)kBatch;
+    r.p99 = (double)p99 / (double)kBatch;
+    return r;
+}
+
+// Median cost of an empty timed region
+static uint64_t calibrate()
+{
+    std::vector<uint64_t> s(kTicks / kBatch * kPasses);
+    for (size_t i = 0; i < s.size(); i++) {
+        const uint64_t t0 = stamp();
+        const uint64_t t1 = stamp();
+        s[i] = t1 - t0;
+    }
+    std::sort(s.begin(), s.end());
+    return s[s.size() / 2];
+}
+
+static Result benchPattern(const std::vector<uint8_t>& raw, uint64_t overhead)
+{
+    ButtonDebounce btn;
+    std::vector<uint64_t> batches;
+    batches.reserve(kTicks / kBatch * kPasses);
+    uint32_t events = 0u;
+
+    for (size_t pass = 0; pass < kPasses; pass++) {
+        for (size_t b = 0; b < kTicks; b += kBatch) {
+            const uint8_t* in = &raw[b];
+            const uint64_t t0 = stamp();
+            for (size_t t = 0; t < kBatch; t++) {
+                btn.update(in[t] != 0u);
+                events += btn.pressed();
+            }
+            const uint64_t t1 = stamp();
+            batches.push_back(t1 - t0);
+        }
+    }
+
+    g_sink = events;
+    return summarize(batches, overhead);
+}
+
+int main()
+{
+    const uint64_t overhead = calibrate();
+
+    printf("engine: %s\n", BENCH_ENGINE_NAME);
+    printf("timer overhead: %lu %s per batch (subtracted)\n", (unsigned long)overhead, BENCH_UNIT);
+    printf("%s per call, batches of %lu calls\n", BENCH_UNIT, (unsigned long)kBatch);
+    printf("%-8s %10s %10s %8s %8s\n", "pattern", "mean", "stddev", "min", "p99");
+
+    double lo = 1e300, hi = 0.0;
+    double min_lo = 1e300, min_hi = 0.0;
+    for (int p = 0; p < PatternCount; p++) {
+        const Result r = benchPattern(makePattern((Pattern)p), overhead);
+        printf("%-8s %10.2f %10.2f %8.2f %8.2f\n", kPatternName[p], r.mean, r.stddev,
+               r.min, r.p99);
+        lo = std::min(lo, r.mean);
+        hi = std::max(hi, r.mean);
+        min_lo = std::min(min_lo, r.min);
+        min_hi = std::max(min_hi, r.min);
+    }
+
+    printf("mean spread across patterns: %.2f %s\n", hi - lo, BENCH_UNIT);
+    printf("min spread across patterns:  %.2f %s\n", min_hi - min_lo, BENCH_UNIT);
+    return 0;
+}
@@ -0,0 +1,551 @@
+/**
+ * ButtonDebounce - Modular Button Debouncing Library
+ * 
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ * 
+ * A flexible button debouncing library with interchangeable algorithms.
+ * Supports integrator, consecutive, edge-gated, adaptive, majority, median,
+ * leaky-integrator, HMM (Viterbi), hybrid and pattern-mask debouncing
+ * methods.
+ * 
+ * Usage:
+ *   ButtonDebounce btn;
+ *   btn.update(digitalRead(PIN));  // Call every 5ms
+ *   if (btn.pressed()) { ... }     // One-shot press event
+ * 
+ * Build: Compile exactly ONE engine implementation:
+ *   - buttonDebounceIntegrator.cpp (recommended)
+ *   - buttonDebounceConsecutive.cpp  
+ *   - buttonDebounceEdgeGated.cpp
+ *   - buttonDebounceAdaptive.cpp
+ *   - buttonDebounceMajority.cpp
+ *   - buttonDebounceMedian.cpp
+ *   - buttonDebounceLeaky.cpp
+ *   - buttonDebounceHmm.cpp
+ *   - buttonDebounceHybrid.cpp
+ *   - buttonDebouncePattern.cpp
+ *
+ * Header-only: define BUTTON_DEBOUNCE_HEADER_ONLY (project-wide) and
+ * optionally one BUTTON_DEBOUNCE_ENGINE_* selector; no .cpp is needed.
+ */
+
+#pragma once
+#include "ButtonDebounceVersion.h"
+#include "ButtonDebounceProfile.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+// Engine .cpp definitions are marked BUTTON_DEBOUNCE_INLINE so the same
+// files serve both the compiled and the header-only build.
+#ifndef BUTTON_DEBOUNCE_INLINE
+#if defined(BUTTON_DEBOUNCE_HEADER_ONLY)
+#define BUTTON_DEBOUNCE_INLINE inline
+#else
+#define BUTTON_DEBOUNCE_INLINE
+#endif
+#endif
+
+/**
+ * ButtonDebounce - modular debouncer with interchangeable engines.
+ *
+ * Contract:
+ *  - Call update() at a fixed tick interval (e.g., 5 ms).
+ *  - Pass raw_down: true = pressed/down, false = released/up.
+ *  - pressed()/released() are one-shot (true for exactly one tick).
+ *  - down()/up() are debounced level.
+ *
+ * Build:
+ *  - Compile exactly ONE engine .cpp:
+ *      buttonDebounceIntegrator.cpp   (recommended)
+ *      buttonDebounceConsecutive.cpp
+ *      buttonDebounceEdgeGated.cpp
+ *      buttonDebounceAdaptive.cpp
+ *      buttonDebounceMajority.cpp
+ *      buttonDebounceMedian.cpp
+ *      buttonDebounceLeaky.cpp
+ *      buttonDebounceHmm.cpp
+ *      buttonDebounceHybrid.cpp
+ *      buttonDebouncePattern.cpp
+ *  - Or define BUTTON_DEBOUNCE_HEADER_ONLY and select the engine with
+ *      BUTTON_DEBOUNCE_ENGINE_INTEGRATOR   (default)
+ *      BUTTON_DEBOUNCE_ENGINE_CONSECUTIVE
+ *      BUTTON_DEBOUNCE_ENGINE_EDGE_GATED
+ *      BUTTON_DEBOUNCE_ENGINE_ADAPTIVE
+ *      BUTTON_DEBOUNCE_ENGINE_MAJORITY
+ *      BUTTON_DEBOUNCE_ENGINE_MEDIAN
+ *      BUTTON_DEBOUNCE_ENGINE_LEAKY
+ *      BUTTON_DEBOUNCE_ENGINE_HMM
+ *      BUTTON_DEBOUNCE_ENGINE_HYBRID
+ *      BUTTON_DEBOUNCE_ENGINE_PATTERN
+ *    The engine is then included below as inline code, so update()
+ *    inlines into scan loops without LTO.
+ *  - Define BUTTON_DEBOUNCE_INTEGRATOR_16BIT for a 16-bit integrator
+ *    accumulator (integ_* fields become uint16_t, integ_max up to 65535;
+ *    Integrator and Hybrid engines).
+ *  - Define BUTTON_DEBOUNCE_PATTERN_BITS as 8 (default), 16, 32 or 64 for
+ *    the Pattern engine's history width (64 widens the engine union).
+ *  - Define BUTTON_DEBOUNCE_CONSTANT_TIME for branch-free update() in the
+ *    Integrator, Consecutive, EdgeGated and Hybrid engines: the same results,
+ *    with a cycle count that does not depend on the input or the state.
+ *
+ * Notes:
+ *  - history() returns a meaningful value for history-based engines
+ *    (Consecutive, EdgeGated, Adaptive, Majority, Median, Leaky, Hmm,
+ *    Hybrid, Pattern: newest 8 samples). For Integrator, it returns 0.
+ *  - save()/restore() copy the run-time state (not the Config) to and
+ *    from a packed SavedState, e.g. across deep sleep in retention RAM.
+ */
+
+template <size_t N> class ButtonBank;
+
+// Malformed ButtonDebounce::pattern() string. In a constant expression
+// either branch stops compilation: a throw, or (with exceptions disabled,
+// as on most MCU toolchains) a call to a function that is not constexpr.
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#define BUTTON_DEBOUNCE_PATTERN_REJECT(msg, fallback) (throw msg)
+#else
+inline void buttonDebouncePatternRejected(const char*) {}
+#define BUTTON_DEBOUNCE_PATTERN_REJECT(msg, fallback) (buttonDebouncePatternRejected(msg), fallback)
+#endif
+
+class ButtonDebounce {
+public:
+#if defined(BUTTON_DEBOUNCE_INTEGRATOR_16BIT)
+    typedef uint16_t IntegValue;
+#else
+    typedef uint8_t IntegValue;
+#endif
+
+#if !defined(BUTTON_DEBOUNCE_PATTERN_BITS) || BUTTON_DEBOUNCE_PATTERN_BITS == 8
+    typedef uint8_t PatternBits;
+#elif BUTTON_DEBOUNCE_PATTERN_BITS == 16
+    typedef uint16_t PatternBits;
+#elif BUTTON_DEBOUNCE_PATTERN_BITS == 32
+    typedef uint32_t PatternBits;
+#elif BUTTON_DEBOUNCE_PATTERN_BITS == 64
+    typedef uint64_t PatternBits;
+#else
+#error "BUTTON_DEBOUNCE_PATTERN_BITS must be 8, 16, 32 or 64"
+#endif
+
+    // Pattern engine rule over the history (LSB = newest sample): fires
+    // when (history & care) == match
+    struct Pattern {
+        PatternBits care;    // history bits that take part
+        PatternBits match;   // their required values (1 = down)
+    };
+
+    // Build a Pattern from a string, oldest sample first, at compile time:
+    // '1' down, '0' up, 'x' don't care, '_' ignored (a separator). Any other
+    // character, or more than BUTTON_DEBOUNCE_PATTERN_BITS positions, is a
+    // compile error when the result is a constant expression (e.g. a
+    // constexpr Pattern); a run-time call is not checked the same way.
+    //   constexpr ButtonDebounce::Pattern p = ButtonDebounce::pattern("00xxx111");
+    static constexpr Pattern pattern(const char* s)
+    {
+        return patternLength(s, 0u) <= 8u * sizeof(PatternBits)
+             ? Pattern{ patternBits(s, 0u, false), patternBits(s, 0u, true) }
+             : BUTTON_DEBOUNCE_PATTERN_REJECT("pattern(): longer than BUTTON_DEBOUNCE_PATTERN_BITS",
+                                              Pattern());
+    }
+
+    struct Config {
+        // Integrator (saturating counter + hysteresis)
+        IntegValue integ_max  = 6;   // accumulator range 0..max
+        IntegValue integ_on   = 4;   // threshold to go pressed
+        IntegValue integ_off  = 2;   // threshold to go released
+        IntegValue integ_up   = 1;   // added per down sample (press slew)
+        IntegValue integ_down = 1;   // taken per up sample (release slew)
+
+        // Consecutive (N consecutive identical samples)
+        uint8_t consec_n  = 3;   // 3 samples @ 5ms = 15ms
+
+        // Asymmetric acceptance (consecutive + edge-gated)
+        uint8_t press_n   = 0;       // samples to accept a press   (0 = consec_n)
+        uint8_t release_n = 0;       // samples to accept a release (0 = consec_n)
+        bool    eager_press   = false;  // press on the first raw edge, then lock out
+        bool    eager_release = false;  // release on the first raw edge, then lock out
+        uint8_t lockout_ticks = 10;     // line ignored after an eager event (~50ms @ 5ms)
+
+        // Edge-gated (history + chatter suppression + timeout recenter)
+        uint8_t edge_threshold   = 4;   // edges in window to call "bouncing"
+        uint8_t unstable_timeout = 16;  // ticks before recenter (~80ms @ 5ms)
+        uint8_t bounce_confirm   = 1;   // require bouncing for K ticks before gating
+
+        // Adaptive (per-button stability window learned from bounce length)
+        uint8_t adapt_min = 2;   // shortest window, used by clean switches
+        uint8_t adapt_max = 8;   // longest window; also the quiet gap that ends a burst
+
+        // Majority (vote over a sliding window)
+        uint8_t maj_window = 5;  // samples in the window (1..8)
+        uint8_t maj_on     = 4;  // votes needed to go pressed
+        uint8_t maj_off    = 1;  // votes at or below which to go released
+
+        // Median (median of the last med_n samples)
+        uint8_t med_n = 5;       // window, odd 1..7 (even values round down)
+
+        // Leaky integrator (exponential average of raw samples, Q0.16)
+        uint8_t  leak_shift = 2;        // time constant 2^shift ticks (0..15)
+        uint16_t leak_on    = 0xC000u;  // average to go pressed  (75%)
+        uint16_t leak_off   = 0x4000u;  // average to go released (25%)
+
+        // HMM (two-state Markov model, fixed-lag Viterbi decode)
+        uint8_t hmm_flip_pct  = 2;   // chance per tick the contact really changes (1..49)
+        uint8_t hmm_noise_pct = 20;  // chance per sample of a wrong read (1..49)
+        uint8_t hmm_lag       = 3;   // decision delay in ticks (0..7)
+
+        // Pattern mask (press / release rules on the history, see pattern())
+        Pattern pat_press   = { 0xC7u, 0x07u };   // "00xxx111": 3 down after 2 up
+        Pattern pat_release = { 0xC7u, 0xC0u };   // "11xxx000": 3 up after 2 down
+
+        // Event latching: pressed()/released() stay set until consumed
+        bool latch_events = false;
+    };
+
+    ButtonDebounce() : ButtonDebounce(Config()) {}
+    explicit ButtonDebounce(const Config& cfg);
+
+    // Call each tick
+    void update(bool raw_down);
+
+    // Convenience for raw pin reads
+    void updateActiveLow(bool pin_level_high)  { update(!pin_level_high); } // pressed when pin reads 0
+    void updateActiveHigh(bool pin_level_high) { update(pin_level_high); }  // pressed when pin reads 1
+
+    // One-shot events (latched mode: pending until consumed)
+    bool pressed()  const { return cfg_.latch_events ? pressCount() != 0u : pressed_; }
+    bool released() const { return cfg_.latch_events ? releaseCount() != 0u : released_; }
+
+    // Consume one pending event. Safe to call from a slower consumer loop
+    // while update() runs in an ISR: the scanner only writes the *_seq_
+    // counters and the consumer only writes the *_ack_ counters.
+    bool consumePressed()
+    {
+        if (pressCount() == 0u) return false;
+        press_ack_++;
+        return true;
+    }
+
+    bool consumeReleased()
+    {
+        if (releaseCount() == 0u) return false;
+        release_ack_++;
+        return true;
+    }
+
+    // Pending (unconsumed) event counts, saturating at 255
+    uint8_t pressCount()   const { return (uint8_t)(shared(press_seq_) - press_ack_); }
+    uint8_t releaseCount() const { return (uint8_t)(shared(release_seq_) - release_ack_); }
+
+    // Debounced level
+    bool down() const { return state_; }
+    bool up()   const { return !state_; }
+
+    // History byte (LSB = newest). 0 if engine doesn't use history.
+    uint8_t history() const;
+
+    // True when another update() with the same raw sample as the last one
+    // would change nothing (no one-shot or unconsumed latched event pending,
+    // engine at a fixed point). Banks use it to skip idle lanes.
+    bool settled() const { return !pressed() && !released() && engineSettled(); }
+
+    // True while the engine is mid-debounce: another update() with the last
+    // raw sample would still move it. Unlike settled(), events (one-shot or
+    // latched and unconsumed) play no part.
+    bool debouncing() const { return !engineSettled(); }
+
+    // Reset to known debounced state
+    void reset(bool start_down = false);
+
+    // Engine compiled into this build (stored in SavedState)
+    enum Engine : uint8_t {
+        kEngineIntegrator  = 1,
+        kEngineConsecutive = 2,
+        kEngineEdgeGated   = 3,
+        kEngineAdaptive    = 4,
+        kEngineMajority    = 5,
+        kEngineMedian      = 6,
+        kEngineLeaky       = 7,
+        kEngineIntegrator16 = 8,  // 16-bit accumulator: different layout
+        kEngineHmm         = 9,
+        kEngineHybrid      = 10,
+        kEngineHybrid16    = 11,  // 16-bit accumulator: different layout
+        kEnginePattern     = 12,
+        kEnginePattern16   = 13,  // BUTTON_DEBOUNCE_PATTERN_BITS 16 / 32 / 64
+        kEnginePattern32   = 14,
+        kEnginePattern64   = 15
+    };
+    static uint8_t engineId();
+
+    // Leaky engine step, y += (target - y) >> shift with target 0 or
+    // 0xFFFF, shift-and-add only. Shared with LeakyBank (bit-identical).
+    static uint16_t leakyStep(uint16_t y, bool raw_down, uint8_t shift)
+    {
+        return raw_down ? (uint16_t)(y + ((uint16_t)~y >> shift))
+                        : (uint16_t)(y - (y >> shift));
+    }
+
+#if defined(BUTTON_DEBOUNCE_PROFILE)
+    // Cycles spent in update(), all instances (see ButtonDebounceProfile.h)
+    static ProfileStats& profile() { return ProfileSlot<ButtonDebounce>::stats; }
+#endif
+
+private:
+    template <size_t N> friend class ButtonBank;
+
+    Config cfg_;
+
+    // Keep engine state compact via a union.
+    struct IntegratorState {
+        IntegValue acc = 0;
+    };
+
+    struct HistoryState {
+        uint8_t hist = 0;       // 8-sample shift register
+        uint8_t unstable = 0;   // edge-gated timeout counter
+        uint8_t bounce_k = 0;   // consecutive bouncing detections
+        uint8_t lockout = 0;    // ticks left in an eager-mode hold-off
+    };
+
+    struct AdaptiveState {
+        uint8_t hist = 0;       // 8-sample shift register
+        uint8_t window = 0;     // learned stability window (ticks)
+        uint8_t run = 0;        // ticks since the last raw edge
+        uint8_t span = 0;       // ticks since the current bounce burst began
+    };
+
+    struct MedianState {
+        uint8_t hist = 0;       // 8-sample shift register
+        uint8_t ones = 0;       // ones among the newest n samples
+        uint8_t n = 0;          // window length (odd, from med_n)
+    };
+
+    struct LeakyState {
+        uint16_t y = 0;         // Q0.16 average of raw samples
+        uint8_t hist = 0;       // 8-sample shift register
+    };
+
+    struct HybridState {
+        IntegValue acc = 0;     // integrator accumulator
+        uint8_t hist = 0;       // 8-sample shift register
+        uint8_t unstable = 0;   // ticks spent bouncing (timeout counter)
+    };
+
+    struct PatternState {
+        PatternBits hist = 0;   // shift register, BUTTON_DEBOUNCE_PATTERN_BITS samples
+    };
+
+    struct HmmState {
+        int8_t  diff = 0;       // path cost of "down" minus "up", 1/8 bit
+        uint8_t path0 = 0;      // survivor states of the path ending up
+        uint8_t path1 = 0;      // survivor states of the path ending down
+        uint8_t hist = 0;       // 8-sample shift register
+    };
+
+    // Run-time state from eng_ to release_ack_ is saved/restored as one
+    // block: keep it contiguous (engine union first, then bytes only).
+    union EngineState {
+        IntegratorState integrator;
+        HistoryState    history;
+        AdaptiveState   adaptive;
+        MedianState     median;
+        LeakyState      leaky;
+        HmmState        hmm;
+        HybridState     hybrid;
+        PatternState    pattern;
+        EngineState() : integrator{} {}
+    } eng_;
+
+    bool state_    = false;
+    bool pressed_  = false;
+    bool released_ = false;
+
+    // Event counters: seq advanced by update(), ack by consume*()
+    uint8_t press_seq_   = 0;
+    uint8_t press_ack_   = 0;
+    uint8_t release_seq_ = 0;
+    uint8_t release_ack_ = 0;
+
+    // Start of a tick: one-shot mode drops events the caller didn't consume
+    void beginTick()
+    {
+        pressed_ = false;
+        released_ = false;
+        if (!cfg_.latch_events) {
+            press_ack_ = press_seq_;
+            release_ack_ = release_seq_;
+        }
+    }
+
+    void notePressed()
+    {
+        state_ = true;
+        pressed_ = true;
+        if ((uint8_t)(press_seq_ - shared(press_ack_)) != 255u) press_seq_++;
+    }
+
+    void noteReleased()
+    {
+        state_ = false;
+        released_ = true;
+        if ((uint8_t)(release_seq_ - shared(release_ack_)) != 255u) release_seq_++;
+    }
+
+    // Branch-free event update for the constant-time engines (pr/rl are 0 or 1)
+    void noteEvents(uint8_t pr, uint8_t rl)
+    {
+        state_    = (((state_ | pr) & ~rl) & 1u) != 0u;
+        pressed_  = (pressed_ | pr) != 0u;
+        released_ = (released_ | rl) != 0u;
+        press_seq_   = (uint8_t)(press_seq_ +
+                       (pr & (uint8_t)((uint8_t)(press_seq_ - shared(press_ack_)) != 255u)));
+        release_seq_ = (uint8_t)(release_seq_ +
+                       (rl & (uint8_t)((uint8_t)(release_seq_ - shared(release_ack_)) != 255u)));
+    }
+
+    void clearEvents()
+    {
+        pressed_ = false;
+        released_ = false;
+        press_seq_ = press_ack_ = 0u;
+        release_seq_ = release_ack_ = 0u;
+    }
+
+    // Engine part of settled(), defined by each engine
+    bool engineSettled() const;
+
+    // Force a fresh load of a counter owned by the other context
+    static uint8_t shared(const uint8_t& v) { return *(const volatile uint8_t*)&v; }
+
+    // pattern() helpers: care bits (want_match false) or match bits, and
+    // the number of sample positions
+    static constexpr PatternBits patternBits(const char* s, PatternBits acc, bool want_match)
+    {
+        return *s == '\0' ? acc
+             : *s == '_'  ? patternBits(s + 1, acc, want_match)
+             : (*s == '0' || *s == '1' || *s == 'x')
+             ? patternBits(s + 1, (PatternBits)((PatternBits)(acc << 1) |
+                   (want_match ? (*s == '1') : (*s != 'x'))), want_match)
+             : BUTTON_DEBOUNCE_PATTERN_REJECT("pattern(): only '0', '1', 'x' and '_' allowed", acc);
+    }
+
+    static constexpr unsigned patternLength(const char* s, unsigned n)
+    {
+        return *s == '\0' ? n : patternLength(s + 1, n + (*s != '_' ? 1u : 0u));
+    }
+
+public:
+    // Bump when the layout changes. A 64-bit pattern history widens the
+    // engine union, so that layout is versioned separately.
+    static const uint8_t kSaveVersion = (sizeof(EngineState) == 4u) ? 2u : 0x82u;
+    static const size_t  kStateBytes  = sizeof(EngineState) + 7u;
+
+    // Packed, versioned copy of the run-time state (byte array only, so it
+    // can be memcpy'd into retention RAM or sent to a standby controller)
+    struct SavedState {
+        uint8_t version;              // kSaveVersion
+        uint8_t engine;               // engineId() of the writer
+        uint8_t state[kStateBytes];   // eng_ .. release_ack_
+    };
+
+    void save(SavedState& out) const
+    {
+        out.version = kSaveVersion;
+        out.engine = engineId();
+        saveState(out.state);
+    }
+
+    // Returns false (and changes nothing) if the blob was written by
+    // another engine or layout version; reset() is the fallback then.
+    bool restore(const SavedState& in)
+    {
+        if (in.version != kSaveVersion || in.engine != engineId()) return false;
+        restoreState(in.state);
+        return true;
+    }
+
+private:
+    void saveState(uint8_t* out) const { memcpy(out, (const void*)&eng_, kStateBytes); }
+
+    void restoreState(const uint8_t* in)
+    {
+        static_assert(offsetof(ButtonDebounce, release_ack_) + 1u -
+                      offsetof(ButtonDebounce, eng_) == kStateBytes,
+                      "run-time state must be contiguous for save/restore");
+        memcpy((void*)&eng_, in, kStateBytes);
+    }
+
+protected:
+    // Shared helpers for history engines (implemented inline here to avoid repetition)
+    static inline void update_hist(uint8_t* h, bool raw_down)
+    {
+        *h = (uint8_t)((*h << 1) | (raw_down ? 1u : 0u));
+    }
+
+    // Conditional select without a branch: cond (0 or 1) ? a : b
+    static inline uint8_t select8(uint8_t cond, uint8_t a, uint8_t b)
+    {
+        const uint8_t m = (uint8_t)(0u - cond);
+        return (uint8_t)((a & m) | (b & (uint8_t)~m));
+    }
+
+    // Branch-free minimum (compiles to a conditional move / select)
+    static inline uint32_t min32(uint32_t a, uint32_t b)
+    {
+        const uint32_t m = 0u - (uint32_t)(a < b);
+        return (a & m) | (b & ~m);
+    }
+
+    // Mask of the newest n history bits (n = 0 falls back to fallback)
+    static inline uint8_t run_mask(uint8_t n, uint8_t fallback)
+    {
+        if (n == 0u) n = fallback;
+        return (n >= 8u) ? 0xFFu : (uint8_t)((1u << n) - 1u);
+    }
+
+    static inline uint8_t popcount8(uint8_t x)
+    {
+        x = (uint8_t)((x & 0x55u) + ((x >> 1) & 0x55u));
+        x = (uint8_t)((x & 0x33u) + ((x >> 2) & 0x33u));
+        return (uint8_t)((x + (x >> 4)) & 0x0Fu);
+    }
+
+    static inline uint8_t edgeCount8(uint8_t hist)
+    {
+        // edges = transitions between adjacent samples
+        uint8_t t = (uint8_t)(hist ^ (hist >> 1));
+        return popcount8(t);
+    }
+};
+
+// Header-only: pull in the selected engine as inline definitions. Engine
+// .cpp files compiled on their own in this mode reduce to nothing.
+#if defined(BUTTON_DEBOUNCE_HEADER_ONLY)
+#define BUTTON_DEBOUNCE_ENGINE_BODY
+#if defined(BUTTON_DEBOUNCE_ENGINE_CONSECUTIVE)
+#include "buttonDebounceConsecutive.cpp"
+#elif defined(BUTTON_DEBOUNCE_ENGINE_EDGE_GATED)
+#include "buttonDebounceEdgeGated.cpp"
+#elif defined(BUTTON_DEBOUNCE_ENGINE_ADAPTIVE)
+#include "buttonDebounceAdaptive.cpp"
+#elif defined(BUTTON_DEBOUNCE_ENGINE_MAJORITY)
+#include "buttonDebounceMajority.cpp"
+#elif defined(BUTTON_DEBOUNCE_ENGINE_MEDIAN)
+#include "buttonDebounceMedian.cpp"
+#elif defined(BUTTON_DEBOUNCE_ENGINE_LEAKY)
+#include "buttonDebounceLeaky.cpp"
+#elif defined(BUTTON_DEBOUNCE_ENGINE_HMM)
+#include "buttonDebounceHmm.cpp"
+#elif defined(BUTTON_DEBOUNCE_ENGINE_HYBRID)
+#include "buttonDebounceHybrid.cpp"
+#elif defined(BUTTON_DEBOUNCE_ENGINE_PATTERN)
+#include "buttonDebouncePattern.cpp"
+#else
+#include "buttonDebounceIntegrator.cpp"
+#endif
+#undef BUTTON_DEBOUNCE_ENGINE_BODY
+#endif
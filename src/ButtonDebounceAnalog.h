@@ -0,0 +1,186 @@
+/**
+ * ButtonDebounce - Analog Inputs
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * Debouncing for "buttons" read through the ADC: hall-effect triggers,
+ * pressure pads and resistor-ladder keypads. Integer-only, no FPU needed.
+ *
+ * AnalogDebounce:
+ * - Fixed-point IIR low-pass: y += (x - y) >> filter_shift
+ * - Schmitt trigger: pressed at y >= press_level, released at
+ *   y <= release_level (press_level > release_level)
+ * - Same pressed()/released()/down()/up() contract as ButtonDebounce
+ *
+ * AnalogLadder<K>:
+ * - Maps one ADC channel to K virtual buttons via a table of sample
+ *   windows, one window per key
+ * - A key is accepted after ladder_n consecutive samples decode to it
+ * - Reports down/pressed/released as bitmasks (bit k = key k)
+ *
+ * Usage:
+ *   AnalogDebounce trigger;
+ *   trigger.update(analogRead(HALL_PIN));   // Call every tick
+ *   if (trigger.pressed()) { ... }
+ *
+ *   static const AnalogLadder<3>::Key kKeys[3] = {
+ *       {    0,  300 },   // key 0: shorted to ground
+ *       {  900, 1300 },   // key 1
+ *       { 1800, 2300 },   // key 2
+ *   };
+ *   AnalogLadder<3> keypad(kKeys);
+ *   keypad.update(analogRead(LADDER_PIN));
+ *   if (keypad.pressed() & (1u << 1)) { ... }
+ *
+ * Notes:
+ *  - Filter settling time is roughly 2^filter_shift samples. Integer
+ *    truncation leaves y within 2^filter_shift counts below a rising input.
+ *  - Samples are expected in 0..0x7FFF (12/14-bit ADCs as-is; shift
+ *    16-bit ADC results right by one) so the filter matches AnalogBank.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+class AnalogDebounce {
+public:
+    struct Config {
+        uint8_t  filter_shift  = 2;     // IIR strength: 0 = no filtering
+        uint16_t press_level   = 2600;  // filtered level to go pressed
+        uint16_t release_level = 1500;  // filtered level to go released
+    };
+
+    AnalogDebounce() : AnalogDebounce(Config()) {}
+    explicit AnalogDebounce(const Config& cfg) : cfg_(cfg) { reset(0u); }
+
+    // Call each tick with the raw ADC sample
+    void update(uint16_t sample)
+    {
+        pressed_ = false;
+        released_ = false;
+
+        value_ = filterStep(value_, sample, cfg_.filter_shift);
+
+        if (!state_ && value_ >= cfg_.press_level) {
+            state_ = true;
+            pressed_ = true;
+        } else if (state_ && value_ <= cfg_.release_level) {
+            state_ = false;
+            released_ = true;
+        }
+    }
+
+    // One-shot events
+    bool pressed()  const { return pressed_; }
+    bool released() const { return released_; }
+
+    // Debounced level
+    bool down() const { return state_; }
+    bool up()   const { return !state_; }
+
+    // Filtered sample
+    uint16_t value() const { return value_; }
+
+    // Reset the filter to a known sample; level follows the thresholds
+    void reset(uint16_t sample)
+    {
+        value_ = sample;
+        state_ = (sample >= cfg_.press_level);
+        pressed_ = false;
+        released_ = false;
+    }
+
+    // One IIR step, shared with AnalogBank's scalar path
+    static inline uint16_t filterStep(uint16_t y, uint16_t x, uint8_t shift)
+    {
+        const int32_t d = (int32_t)x - (int32_t)y;
+        return (uint16_t)((int32_t)y + (d >> shift));
+    }
+
+private:
+    Config   cfg_;
+    uint16_t value_    = 0;
+    bool     state_    = false;
+    bool     pressed_  = false;
+    bool     released_ = false;
+};
+
+template <size_t K>
+class AnalogLadder {
+    static_assert(K >= 1u && K <= 32u, "AnalogLadder supports 1..32 keys");
+
+public:
+    static const size_t kKeys = K;
+    static const uint8_t kNone = 0xFFu;
+
+    struct Key {
+        uint16_t lo;   // inclusive sample window for this key
+        uint16_t hi;
+    };
+
+    struct Config {
+        uint8_t ladder_n = 3;   // consecutive matching decodes to accept a key
+    };
+
+    explicit AnalogLadder(const Key (&table)[K]) : AnalogLadder(table, Config()) {}
+    AnalogLadder(const Key (&table)[K], const Config& cfg) : table_(table), cfg_(cfg) { reset(); }
+
+    // Call each tick with the raw ADC sample
+    void update(uint16_t sample)
+    {
+        pressed_ = 0u;
+        released_ = 0u;
+
+        const uint8_t key = decode(sample);
+        if (key != candidate_) {
+            candidate_ = key;
+            count_ = 0u;
+        }
+        if (count_ < 255u) count_++;
+
+        if (count_ >= cfg_.ladder_n && candidate_ != active_) {
+            if (active_ != kNone) released_ = 1u << active_;
+            if (candidate_ != kNone) pressed_ = 1u << candidate_;
+            active_ = candidate_;
+        }
+    }
+
+    // Key masks (bit k = table entry k)
+    uint32_t down()     const { return (active_ != kNone) ? (1u << active_) : 0u; }
+    uint32_t pressed()  const { return pressed_; }
+    uint32_t released() const { return released_; }
+
+    // Currently accepted key index, or kNone
+    uint8_t key() const { return active_; }
+
+    void reset()
+    {
+        candidate_ = kNone;
+        active_ = kNone;
+        count_ = 0u;
+        pressed_ = 0u;
+        released_ = 0u;
+    }
+
+    // Key whose window contains sample, or kNone
+    uint8_t decode(uint16_t sample) const
+    {
+        for (size_t k = 0; k < K; k++) {
+            if (sample >= table_[k].lo && sample <= table_[k].hi) return (uint8_t)k;
+        }
+        return kNone;
+    }
+
+private:
+    const Key* table_;
+    Config     cfg_;
+
+    uint8_t  candidate_;
+    uint8_t  active_;
+    uint8_t  count_;
+    uint32_t pressed_;
+    uint32_t released_;
+};
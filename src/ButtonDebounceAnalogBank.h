@@ -0,0 +1,199 @@
+/**
+ * ButtonDebounce - Analog Bank
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * AnalogDebounce for a whole multi-channel ADC frame at once. Filter
+ * state is stored structure-of-arrays (one uint16_t per channel,
+ * contiguous) so a DMA frame is filtered and thresholded with SIMD.
+ *
+ * Paths (selected at compile time):
+ * - AVX2:           16 channels per step
+ * - SSE2:            8 channels per step
+ * - ARM DSP SIMD32:  2 channels per step (Cortex-M4/M7/M33)
+ * - Scalar fallback
+ * All paths produce bit-identical results to AnalogDebounce.
+ *
+ * Usage:
+ *   AnalogBank<32> pads;                    // shares AnalogDebounce::Config
+ *   void adcDmaComplete(const uint16_t* frame) {
+ *       pads.update(frame);                 // frame[i] = channel i
+ *       uint32_t hits = pads.pressedMask()[0];
+ *   }
+ *
+ * Notes:
+ *  - Samples must be 0..0x7FFF (the SIMD filter uses signed 16-bit
+ *    lanes). Thresholds may use the full 0..0xFFFF range.
+ *  - Define BUTTON_DEBOUNCE_NO_SIMD to force the scalar path.
+ */
+
+#pragma once
+#include "ButtonDebounceAnalog.h"
+#include "ButtonDebounceProfile.h"
+#include <string.h>
+
+#if !defined(BUTTON_DEBOUNCE_NO_SIMD)
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define BUTTON_DEBOUNCE_ANALOG_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define BUTTON_DEBOUNCE_ANALOG_SSE2 1
+#elif defined(__ARM_FEATURE_SIMD32)
+#include <arm_acle.h>
+#define BUTTON_DEBOUNCE_ANALOG_SIMD32 1
+#endif
+#endif
+
+template <size_t N>
+class AnalogBank {
+public:
+    static const size_t kChannels = N;
+    static const size_t kWords    = (N + 31u) / 32u;
+
+    AnalogBank() : AnalogBank(AnalogDebounce::Config()) {}
+    explicit AnalogBank(const AnalogDebounce::Config& cfg) : cfg_(cfg) { reset(0u); }
+
+    // Call each tick with one sample per channel (frame[i] = channel i)
+    void update(const uint16_t* frame)
+    {
+        BUTTON_DEBOUNCE_PROFILE_SCOPE(profile_);
+
+        uint32_t hi[kWords];   // value >= press_level
+        uint32_t lo[kWords];   // value <= release_level
+        for (size_t w = 0; w < kWords; w++) {
+            hi[w] = 0u;
+            lo[w] = 0u;
+        }
+
+        size_t i = 0;
+#if defined(BUTTON_DEBOUNCE_ANALOG_AVX2)
+        {
+            // Unsigned compares as signed ones on values biased by 0x8000:
+            // hi = !(press_level > y), lo = !(y > release_level)
+            const __m128i sh   = _mm_cvtsi32_si128(cfg_.filter_shift);
+            const __m256i bias = _mm256_set1_epi16((int16_t)0x8000);
+            const __m256i on   = _mm256_set1_epi16((int16_t)(cfg_.press_level ^ 0x8000u));
+            const __m256i off  = _mm256_set1_epi16((int16_t)(cfg_.release_level ^ 0x8000u));
+            for (; i < N - N % 16u; i += 16u) {
+                const __m256i x = _mm256_loadu_si256((const __m256i*)(frame + i));
+                __m256i y = _mm256_loadu_si256((const __m256i*)(value_ + i));
+                y = _mm256_add_epi16(y, _mm256_sra_epi16(_mm256_sub_epi16(x, y), sh));
+                _mm256_storeu_si256((__m256i*)(value_ + i), y);
+
+                const __m256i yb = _mm256_xor_si256(y, bias);
+                const uint32_t h = (uint32_t)_mm256_movemask_epi8(
+                    _mm256_packs_epi16(_mm256_cmpgt_epi16(on, yb), _mm256_setzero_si256()));
+                const uint32_t l = (uint32_t)_mm256_movemask_epi8(
+                    _mm256_packs_epi16(_mm256_cmpgt_epi16(yb, off), _mm256_setzero_si256()));
+                // packs interleaves 128-bit halves: lanes 0-7 in bits 0-7, 8-15 in bits 16-23
+                hi[i >> 5] |= (~((h & 0xFFu) | ((h >> 8) & 0xFF00u)) & 0xFFFFu) << (i & 31u);
+                lo[i >> 5] |= (~((l & 0xFFu) | ((l >> 8) & 0xFF00u)) & 0xFFFFu) << (i & 31u);
+            }
+        }
+#elif defined(BUTTON_DEBOUNCE_ANALOG_SSE2)
+        {
+            // Biased compares as in the AVX2 path
+            const __m128i sh   = _mm_cvtsi32_si128(cfg_.filter_shift);
+            const __m128i bias = _mm_set1_epi16((int16_t)0x8000);
+            const __m128i on   = _mm_set1_epi16((int16_t)(cfg_.press_level ^ 0x8000u));
+            const __m128i off  = _mm_set1_epi16((int16_t)(cfg_.release_level ^ 0x8000u));
+            for (; i < N - N % 8u; i += 8u) {
+                const __m128i x = _mm_loadu_si128((const __m128i*)(frame + i));
+                __m128i y = _mm_loadu_si128((const __m128i*)(value_ + i));
+                y = _mm_add_epi16(y, _mm_sra_epi16(_mm_sub_epi16(x, y), sh));
+                _mm_storeu_si128((__m128i*)(value_ + i), y);
+
+                const __m128i yb = _mm_xor_si128(y, bias);
+                const uint32_t h = (uint32_t)_mm_movemask_epi8(
+                    _mm_packs_epi16(_mm_cmpgt_epi16(on, yb), _mm_setzero_si128()));
+                const uint32_t l = (uint32_t)_mm_movemask_epi8(
+                    _mm_packs_epi16(_mm_cmpgt_epi16(yb, off), _mm_setzero_si128()));
+                hi[i >> 5] |= (~h & 0xFFu) << (i & 31u);
+                lo[i >> 5] |= (~l & 0xFFu) << (i & 31u);
+            }
+        }
+#elif defined(BUTTON_DEBOUNCE_ANALOG_SIMD32)
+        // No 16-bit SIMD shift on ARMv7E-M: apply the halving add k times.
+        // SHADD16(y, t) = y + (t - y) / 2 (floored), so after k rounds
+        // t = y + ((x - y) >> k), identical to the scalar filter.
+        for (; i < N - N % 2u; i += 2u) {
+            uint32_t x, y;
+            memcpy(&x, frame + i, sizeof(x));
+            memcpy(&y, value_ + i, sizeof(y));
+            uint32_t t = x;
+            for (uint8_t k = 0; k < cfg_.filter_shift; k++) t = __shadd16(y, t);
+            memcpy(value_ + i, &t, sizeof(t));
+
+            for (size_t j = i; j < i + 2u; j++) {
+                hi[j >> 5] |= (uint32_t)(value_[j] >= cfg_.press_level)   << (j & 31u);
+                lo[j >> 5] |= (uint32_t)(value_[j] <= cfg_.release_level) << (j & 31u);
+            }
+        }
+#endif
+        for (; i < N; i++) {
+            value_[i] = AnalogDebounce::filterStep(value_[i], frame[i], cfg_.filter_shift);
+            hi[i >> 5] |= (uint32_t)(value_[i] >= cfg_.press_level)   << (i & 31u);
+            lo[i >> 5] |= (uint32_t)(value_[i] <= cfg_.release_level) << (i & 31u);
+        }
+
+        // Schmitt trigger on whole words
+        for (size_t w = 0; w < kWords; w++) {
+            pressed_[w]  = ~down_[w] & hi[w];
+            released_[w] = down_[w] & lo[w];
+            down_[w] = (down_[w] | pressed_[w]) & ~released_[w];
+        }
+    }
+
+    // Masks from the last update() (bit i = channel i)
+    const uint32_t* downMask()     const { return down_; }
+    const uint32_t* pressedMask()  const { return pressed_; }
+    const uint32_t* releasedMask() const { return released_; }
+
+    bool down(size_t i)     const { return ((down_[i >> 5]     >> (i & 31u)) & 1u) != 0u; }
+    bool pressed(size_t i)  const { return ((pressed_[i >> 5]  >> (i & 31u)) & 1u) != 0u; }
+    bool released(size_t i) const { return ((released_[i >> 5] >> (i & 31u)) & 1u) != 0u; }
+
+    // Filtered sample of one channel
+    uint16_t value(size_t i) const { return value_[i]; }
+
+#if defined(BUTTON_DEBOUNCE_PROFILE)
+    // Cycles per frame (see ButtonDebounceProfile.h)
+    const ProfileStats& profile() const { return profile_; }
+    void resetProfile() { profile_.reset(); }
+#endif
+
+    // Reset every channel's filter to a known sample
+    void reset(uint16_t sample)
+    {
+        for (size_t i = 0; i < kPadded; i++) value_[i] = sample;
+        const uint32_t lvl = (sample >= cfg_.press_level) ? 0xFFFFFFFFu : 0u;
+        for (size_t w = 0; w < kWords; w++) {
+            down_[w] = lvl & laneMask(w);
+            pressed_[w] = 0u;
+            released_[w] = 0u;
+        }
+    }
+
+private:
+    static const size_t kPadded = (N + 15u) & ~(size_t)15u;
+
+    static uint32_t laneMask(size_t w)
+    {
+        const size_t lanes = N - w * 32u;
+        return (lanes >= 32u) ? 0xFFFFFFFFu : ((1u << lanes) - 1u);
+    }
+
+    AnalogDebounce::Config cfg_;
+
+    uint16_t value_[kPadded];
+    uint32_t down_[kWords];
+    uint32_t pressed_[kWords];
+    uint32_t released_[kWords];
+
+#if defined(BUTTON_DEBOUNCE_PROFILE)
+    ProfileStats profile_;
+#endif
+};
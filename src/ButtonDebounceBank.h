@@ -0,0 +1,431 @@
+/**
+ * ButtonDebounce - Button Bank
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * Fixed-size array of ButtonDebounce instances driven from packed port
+ * words (bit i of the port = button i), with down/pressed/released masks
+ * and a seqlock-published snapshot for readers on other threads or ISRs.
+ *
+ * Usage:
+ *   ButtonBank<40> bank;
+ *
+ *   // Scanner (ISR / scan thread), once per tick:
+ *   uint32_t raw[ButtonBank<40>::kWords] = { readPortA(), readPortB() };
+ *   bank.update(raw);
+ *
+ *   // Any reader (UI thread, logger, control loop):
+ *   ButtonBank<40>::Snapshot s;
+ *   bank.snapshot(s);              // never blocks the scanner
+ *   if (s.isPressed(3)) { ... }    // all masks belong to the same tick
+ *
+ * Notes:
+ *  - Uses whichever engine .cpp is compiled into the build.
+ *  - Exactly one writer (the scanner) is supported. Any number of readers.
+ *  - Readers retry while a publish is in progress; the scanner never waits.
+ *  - save()/restore() move every button's run-time state through one
+ *    contiguous SavedState blob (retention RAM, failover link). The copy
+ *    is one memcpy per button, not one atomic image: call them from the
+ *    scanner's context, never concurrently with update(). Snapshot
+ *    readers see the restored bank only once restore() publishes it.
+ *  - setSkipSettled(true) only runs update() on lanes whose raw bit
+ *    changed or that are still mid-debounce; an idle bank costs a few
+ *    word operations per tick. Masks and events are unchanged.
+ */
+
+#pragma once
+#include "ButtonDebounce.h"
+#include <stddef.h>
+#include <string.h>
+
+// Lock-free publishing uses <atomic> where the toolchain provides it.
+// Single-core targets without it (e.g. AVR) fall back to volatile +
+// compiler barrier, which is sufficient when the scanner is an ISR.
+#ifndef BUTTON_DEBOUNCE_HAS_ATOMIC
+#if defined(__AVR__)
+#define BUTTON_DEBOUNCE_HAS_ATOMIC 0
+#else
+#define BUTTON_DEBOUNCE_HAS_ATOMIC 1
+#endif
+#endif
+
+#if BUTTON_DEBOUNCE_HAS_ATOMIC
+#include <atomic>
+#endif
+
+/**
+ * Coherent copy of a bank's debounced state, captured on one tick.
+ * Bit i of each mask word array corresponds to button i.
+ */
+template <size_t N>
+struct BankSnapshot {
+    static const size_t kWords = (N + 31u) / 32u;
+
+    uint32_t tick;                 // scanner tick the masks belong to
+    uint32_t down[kWords];         // debounced level
+    uint32_t pressed[kWords];      // one-shot press events on that tick
+    uint32_t released[kWords];     // one-shot release events on that tick
+
+    bool isDown(size_t i)     const { return ((down[i >> 5]     >> (i & 31u)) & 1u) != 0u; }
+    bool isPressed(size_t i)  const { return ((pressed[i >> 5]  >> (i & 31u)) & 1u) != 0u; }
+    bool isReleased(size_t i) const { return ((released[i >> 5] >> (i & 31u)) & 1u) != 0u; }
+};
+
+/**
+ * Single-writer sequence lock around a fixed number of 32-bit words.
+ *
+ * Writer: begin() -> store() ... -> end(). The sequence is odd while a
+ * publish is in progress. Readers copy the words and retry if the
+ * sequence was odd or changed underneath them.
+ */
+template <size_t WORDS>
+class BankSeqLock {
+public:
+    BankSeqLock() : seq_(0u)
+    {
+        for (size_t i = 0; i < WORDS; i++) storeCell(cells_[i], 0u);
+    }
+
+    void begin()
+    {
+#if BUTTON_DEBOUNCE_HAS_ATOMIC
+        const uint32_t s = seq_.load(std::memory_order_relaxed);
+        seq_.store(s + 1u, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+#else
+        seq_ = seq_ + 1u;
+        __asm__ __volatile__("" ::: "memory");
+#endif
+    }
+
+    void store(size_t i, uint32_t v) { storeCell(cells_[i], v); }
+
+    void end()
+    {
+#if BUTTON_DEBOUNCE_HAS_ATOMIC
+        const uint32_t s = seq_.load(std::memory_order_relaxed);
+        seq_.store(s + 1u, std::memory_order_release);
+#else
+        __asm__ __volatile__("" ::: "memory");
+        seq_ = seq_ + 1u;
+#endif
+    }
+
+    // Copy all words into out[]. Spins only while a publish is in flight.
+    void read(uint32_t* out) const
+    {
+        for (;;) {
+#if BUTTON_DEBOUNCE_HAS_ATOMIC
+            const uint32_t s0 = seq_.load(std::memory_order_acquire);
+#else
+            const uint32_t s0 = seq_;
+            __asm__ __volatile__("" ::: "memory");
+#endif
+            if (s0 & 1u) continue;
+
+            for (size_t i = 0; i < WORDS; i++) out[i] = loadCell(cells_[i]);
+
+#if BUTTON_DEBOUNCE_HAS_ATOMIC
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const uint32_t s1 = seq_.load(std::memory_order_relaxed);
+#else
+            __asm__ __volatile__("" ::: "memory");
+            const uint32_t s1 = seq_;
+#endif
+            if (s0 == s1) return;
+        }
+    }
+
+private:
+#if BUTTON_DEBOUNCE_HAS_ATOMIC
+    typedef std::atomic<uint32_t> Cell;
+    static void storeCell(Cell& c, uint32_t v)  { c.store(v, std::memory_order_relaxed); }
+    static uint32_t loadCell(const Cell& c)     { return c.load(std::memory_order_relaxed); }
+#else
+    typedef volatile uint32_t Cell;
+    static void storeCell(Cell& c, uint32_t v)  { c = v; }
+    static uint32_t loadCell(const Cell& c)     { return c; }
+#endif
+
+    Cell seq_;
+    Cell cells_[WORDS];
+};
+
+// Index of the lowest set bit (x != 0)
+static inline unsigned bankLowestBit(uint32_t x)
+{
+#if defined(__GNUC__)
+    return (unsigned)__builtin_ctz(x);
+#else
+    unsigned n = 0;
+    while (!(x & 1u)) {
+        x >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+/**
+ * ButtonBank - N debouncers updated together from packed port words.
+ */
+template <size_t N>
+class ButtonBank {
+public:
+    static const size_t kButtons = N;
+    static const size_t kWords   = (N + 31u) / 32u;
+
+    typedef BankSnapshot<N> Snapshot;
+
+    explicit ButtonBank(const ButtonDebounce::Config& cfg = ButtonDebounce::Config{})
+        : tick_(0u),
+          skip_settled_(false)
+    {
+        for (size_t i = 0; i < N; i++) btn_[i] = ButtonDebounce(cfg);
+        clearMasks();
+        markAllUnsettled();
+        publish();
+    }
+
+    // Call each tick. raw_down[w] bit b = raw state of button (w*32 + b).
+    void update(const uint32_t* raw_down) { updateWords(raw_down, 0u); }
+
+    // Convenience for pull-up wiring (pressed when the port bit reads 0)
+    void updateActiveLow(const uint32_t* port) { updateWords(port, 0xFFFFFFFFu); }
+
+    // Bulk path: run count consecutive ticks straight from a sample buffer
+    // (frames[t * kWords + w]), e.g. a completed DMA half-buffer. Masks and
+    // snapshot reflect the last frame; use BankIngest for per-frame events.
+    void updateFrames(const uint32_t* frames, size_t count, bool active_low = false)
+    {
+        const uint32_t flip = active_low ? 0xFFFFFFFFu : 0u;
+        for (size_t t = 0; t < count; t++) updateWords(frames + t * kWords, flip);
+    }
+
+    // Skip update() on lanes whose raw bit is unchanged and whose engine
+    // is settled (see ButtonDebounce::settled()). Off by default.
+    void setSkipSettled(bool on)
+    {
+        skip_settled_ = on;
+        markAllUnsettled();
+    }
+
+    // Reset every button to a known debounced state
+    void reset(bool start_down = false)
+    {
+        for (size_t i = 0; i < N; i++) btn_[i].reset(start_down);
+        clearMasks();
+        markAllUnsettled();
+        if (start_down) {
+            for (size_t i = 0; i < N; i++) down_[i >> 5] |= 1u << (i & 31u);
+        }
+        publish();
+    }
+
+    // Packed, versioned run-time state of the whole bank (Configs excluded).
+    // The buttons' Configs sit between their states, so save() and
+    // restore() copy button by button (N memcpys of kStateBytes each).
+    struct SavedState {
+        uint8_t  version;    // ButtonDebounce::kSaveVersion
+        uint8_t  engine;     // ButtonDebounce::engineId()
+        uint8_t  reserved[2];
+        uint32_t tick;
+        uint8_t  state[N][ButtonDebounce::kStateBytes];
+    };
+
+    // Not a snapshot: an update() running meanwhile (from an ISR) would
+    // leave buttons from two different ticks in the blob
+    void save(SavedState& out) const
+    {
+        out.version = ButtonDebounce::kSaveVersion;
+        out.engine = ButtonDebounce::engineId();
+        out.reserved[0] = out.reserved[1] = 0u;
+        out.tick = tick_;
+        for (size_t i = 0; i < N; i++) btn_[i].saveState(out.state[i]);
+    }
+
+    // One pass: each button's block is copied back and its mask bits are
+    // taken in the same loop, then the tick is published; must not overlap
+    // update(). Returns false (bank unchanged) on engine/version mismatch.
+    bool restore(const SavedState& in)
+    {
+        if (in.version != ButtonDebounce::kSaveVersion ||
+            in.engine != ButtonDebounce::engineId()) {
+            return false;
+        }
+
+        for (size_t w = 0; w < kWords; w++) {
+            const size_t base = w * 32u;
+            const size_t lanes = (N - base < 32u) ? (N - base) : 32u;
+
+            uint32_t dn = 0u, pr = 0u, rl = 0u;
+            for (size_t b = 0; b < lanes; b++) {
+                ButtonDebounce& btn = btn_[base + b];
+                btn.restoreState(in.state[base + b]);
+                dn |= (uint32_t)btn.down()     << b;
+                pr |= (uint32_t)btn.pressed()  << b;
+                rl |= (uint32_t)btn.released() << b;
+            }
+            down_[w] = dn;
+            pressed_[w] = pr;
+            released_[w] = rl;
+        }
+        tick_ = in.tick;
+
+        markAllUnsettled();
+        publish();
+        return true;
+    }
+
+    // Per-button access (scanner side). Mutable access wakes the lane.
+    ButtonDebounce& operator[](size_t i)
+    {
+        unsettled_[i >> 5] |= 1u << (i & 31u);
+        return btn_[i];
+    }
+    const ButtonDebounce& operator[](size_t i) const { return btn_[i]; }
+
+    // Masks from the last update(). Scanner side only: no synchronisation.
+    const uint32_t* downMask()     const { return down_; }
+    const uint32_t* pressedMask()  const { return pressed_; }
+    const uint32_t* releasedMask() const { return released_; }
+    uint32_t tick() const { return tick_; }
+
+#if defined(BUTTON_DEBOUNCE_PROFILE)
+    // Cycles per bank tick (see ButtonDebounceProfile.h)
+    const ProfileStats& profile() const { return profile_; }
+    void resetProfile() { profile_.reset(); }
+#endif
+
+    // Coherent copy of the last published tick. Safe from any reader.
+    void snapshot(Snapshot& out) const
+    {
+        uint32_t words[kPubWords];
+        pub_.read(words);
+
+        out.tick = words[0];
+        memcpy(out.down,     &words[1],              sizeof(out.down));
+        memcpy(out.pressed,  &words[1 + kWords],     sizeof(out.pressed));
+        memcpy(out.released, &words[1 + 2 * kWords], sizeof(out.released));
+    }
+
+private:
+    static const size_t kPubWords = 1u + 3u * kWords;   // tick + 3 masks
+
+    // One tick; flip inverts the port words in place of a copy (active-low)
+    void updateWords(const uint32_t* port, uint32_t flip)
+    {
+        BUTTON_DEBOUNCE_PROFILE_SCOPE(profile_);
+
+        for (size_t w = 0; w < kWords; w++) {
+            const size_t base = w * 32u;
+            const size_t lanes = (N - base < 32u) ? (N - base) : 32u;
+            const uint32_t raw = port[w] ^ flip;
+
+            if (skip_settled_) {
+                updateChanged(w, raw);
+                continue;
+            }
+
+            uint32_t dn = 0u, pr = 0u, rl = 0u;
+            for (size_t b = 0; b < lanes; b++) {
+                ButtonDebounce& btn = btn_[base + b];
+                btn.update(((raw >> b) & 1u) != 0u);
+                dn |= (uint32_t)btn.down()     << b;
+                pr |= (uint32_t)btn.pressed()  << b;
+                rl |= (uint32_t)btn.released() << b;
+            }
+            down_[w] = dn;
+            pressed_[w] = pr;
+            released_[w] = rl;
+        }
+
+        tick_++;
+        publish();
+    }
+
+    // Sparse tick for one word: only lanes whose raw bit changed, that
+    // were not settled after the previous tick, or whose raw bit still
+    // disagrees with the level run the engine. Settled lanes have no
+    // events and keep their level. (A timeout recenter leaves the history
+    // at the level even though the line reads the other way.)
+    void updateChanged(size_t w, uint32_t raw)
+    {
+        const size_t base = w * 32u;
+        const size_t lanes = (N - base < 32u) ? (N - base) : 32u;
+        const uint32_t valid = (lanes == 32u) ? 0xFFFFFFFFu : ((1u << lanes) - 1u);
+
+        uint32_t active = ((raw ^ prev_raw_[w]) | (raw ^ down_[w]) | unsettled_[w]) & valid;
+        prev_raw_[w] = raw;
+        pressed_[w] = 0u;
+        released_[w] = 0u;
+        if (!active) return;
+
+        uint32_t dn = down_[w], pr = 0u, rl = 0u, us = 0u;
+        while (active) {
+            const unsigned b = bankLowestBit(active);
+            const uint32_t bit = 1u << b;
+            active &= active - 1u;
+
+            ButtonDebounce& btn = btn_[base + b];
+            btn.update((raw & bit) != 0u);
+            dn = (dn & ~bit) | ((uint32_t)btn.down() << b);
+            pr |= (uint32_t)btn.pressed() << b;
+            rl |= (uint32_t)btn.released() << b;
+            if (!btn.settled()) us |= bit;
+        }
+        down_[w] = dn;
+        pressed_[w] = pr;
+        released_[w] = rl;
+        unsettled_[w] = us;
+    }
+
+    void markAllUnsettled()
+    {
+        for (size_t w = 0; w < kWords; w++) {
+            unsettled_[w] = 0xFFFFFFFFu;
+            prev_raw_[w] = 0u;
+        }
+    }
+
+    void clearMasks()
+    {
+        for (size_t w = 0; w < kWords; w++) {
+            down_[w] = 0u;
+            pressed_[w] = 0u;
+            released_[w] = 0u;
+        }
+    }
+
+    void publish()
+    {
+        pub_.begin();
+        pub_.store(0, tick_);
+        for (size_t w = 0; w < kWords; w++) {
+            pub_.store(1 + w,              down_[w]);
+            pub_.store(1 + kWords + w,     pressed_[w]);
+            pub_.store(1 + 2 * kWords + w, released_[w]);
+        }
+        pub_.end();
+    }
+
+    ButtonDebounce btn_[N];
+
+    uint32_t down_[kWords];
+    uint32_t pressed_[kWords];
+    uint32_t released_[kWords];
+    uint32_t tick_;
+
+    // Sparse mode: last raw words and lanes not yet settled
+    bool     skip_settled_;
+    uint32_t prev_raw_[kWords];
+    uint32_t unsettled_[kWords];
+
+    BankSeqLock<kPubWords> pub_;
+
+#if defined(BUTTON_DEBOUNCE_PROFILE)
+    ProfileStats profile_;
+#endif
+};
@@ -0,0 +1,141 @@
+/**
+ * ButtonDebounce - Bit-Sliced Helpers
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * Vertical (bit-sliced) counters for bank forms: one 32-bit word per bit
+ * plane, one lane per button. Plane i holds bit i of every lane's count,
+ * so a single pass over the planes updates or compares 32 counters at
+ * once with plain AND/XOR, no per-button branching.
+ *
+ * Usage:
+ *   SlicedCounter<16> t;            // 32 lanes of 16-bit counters
+ *   t.clear(pressed_mask);          // restart lanes that were pressed
+ *   t.increment(held_mask);         // +1 on held lanes (saturating)
+ *   t.decrement(idle_mask);         // -1 on idle lanes (stops at 0)
+ *   uint32_t hit = t.equals(50u);   // lanes whose count is exactly 50
+ *   uint32_t ge = t.atLeast(50u);   // lanes whose count is 50 or more
+ *   t.add(up_mask, 3u, 200u);       // +3 on up lanes, clamped at 200
+ */
+
+#pragma once
+#include <stdint.h>
+
+template <unsigned BITS>
+struct SlicedCounter {
+    uint32_t plane[BITS];
+
+    SlicedCounter()
+    {
+        for (unsigned i = 0; i < BITS; i++) plane[i] = 0u;
+    }
+
+    // Zero the selected lanes
+    void clear(uint32_t lanes)
+    {
+        for (unsigned i = 0; i < BITS; i++) plane[i] &= ~lanes;
+    }
+
+    // Add one to the selected lanes, saturating at 2^BITS - 1
+    void increment(uint32_t lanes)
+    {
+        uint32_t carry = lanes & ~saturated();
+        for (unsigned i = 0; i < BITS && carry; i++) {
+            const uint32_t c = plane[i] & carry;
+            plane[i] ^= carry;
+            carry = c;
+        }
+    }
+
+    // Subtract one from the selected lanes, saturating at 0
+    void decrement(uint32_t lanes)
+    {
+        uint32_t borrow = lanes & ~equals(0u);
+        for (unsigned i = 0; i < BITS && borrow; i++) {
+            const uint32_t b = ~plane[i] & borrow;
+            plane[i] ^= borrow;
+            borrow = b;
+        }
+    }
+
+    // Set the selected lanes to value
+    void set(uint32_t lanes, uint32_t value)
+    {
+        for (unsigned i = 0; i < BITS; i++) {
+            plane[i] = ((value >> i) & 1u) ? (plane[i] | lanes) : (plane[i] & ~lanes);
+        }
+    }
+
+    // Add value to the selected lanes, clamping at limit (lanes must
+    // start at or below limit). Ripple-carry over the planes.
+    void add(uint32_t lanes, uint32_t value, uint32_t limit)
+    {
+        uint32_t carry = 0u;
+        for (unsigned i = 0; i < BITS; i++) {
+            const uint32_t k = ((value >> i) & 1u) ? lanes : 0u;
+            const uint32_t a = plane[i];
+            plane[i] = a ^ k ^ carry;
+            carry = (a & k) | (carry & (a ^ k));
+        }
+        set((carry | atLeast(limit + 1u)) & lanes, limit);
+    }
+
+    // Subtract value from the selected lanes, stopping at 0
+    void sub(uint32_t lanes, uint32_t value)
+    {
+        uint32_t borrow = 0u;
+        for (unsigned i = 0; i < BITS; i++) {
+            const uint32_t k = ((value >> i) & 1u) ? lanes : 0u;
+            const uint32_t a = plane[i];
+            plane[i] = a ^ k ^ borrow;
+            borrow = (~a & k) | (borrow & ~(a ^ k));
+        }
+        clear(borrow);
+    }
+
+    // Lanes whose count is all ones
+    uint32_t saturated() const
+    {
+        uint32_t m = 0xFFFFFFFFu;
+        for (unsigned i = 0; i < BITS; i++) m &= plane[i];
+        return m;
+    }
+
+    // Lanes whose count equals value (value is the same for every lane)
+    uint32_t equals(uint32_t value) const
+    {
+        uint32_t m = 0xFFFFFFFFu;
+        for (unsigned i = 0; i < BITS; i++) {
+            m &= ((value >> i) & 1u) ? plane[i] : ~plane[i];
+        }
+        return m;
+    }
+
+    // Lanes whose count is >= value (magnitude compare, MSB plane first)
+    uint32_t atLeast(uint32_t value) const
+    {
+        if ((value >> BITS) != 0u) return 0u;
+
+        uint32_t gt = 0u;
+        uint32_t eq = 0xFFFFFFFFu;
+        for (unsigned i = BITS; i-- > 0u;) {
+            if ((value >> i) & 1u) {
+                eq &= plane[i];
+            } else {
+                gt |= eq & plane[i];
+                eq &= ~plane[i];
+            }
+        }
+        return gt | eq;
+    }
+
+    // Count of a single lane (for inspection / debugging)
+    uint32_t lane(unsigned b) const
+    {
+        uint32_t v = 0u;
+        for (unsigned i = 0; i < BITS; i++) v |= ((plane[i] >> b) & 1u) << i;
+        return v;
+    }
+};
@@ -0,0 +1,125 @@
+/**
+ * ButtonDebounce - Chord Detection
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * Detects key chords (several buttons pressed together within a timing
+ * window) from a ButtonBank's pressed/down masks.
+ *
+ * Usage:
+ *   typedef ChordDetector<16, 2> Chords;
+ *
+ *   static const Chords::Chord kChords[2] = {
+ *       { { (1u << 0) | (1u << 1) }, 6 },   // A+B within 6 ticks (30ms @ 5ms)
+ *       { { (1u << 2) | (1u << 5) }, 10 },  // C+F within 10 ticks
+ *   };
+ *   Chords chords(kChords);
+ *
+ *   bank.update(raw);
+ *   chords.update(bank);
+ *   if (chords.fired(0)) { ... }
+ *
+ * Rules:
+ *  - A chord arms on the first press of any of its members.
+ *  - It fires once every member has been pressed within window_ticks of
+ *    that first press and all members are still down.
+ *  - It disarms when the window expires or a pressed member is released.
+ *
+ * Notes:
+ *  - The chord table is caller-owned (typically static const); nothing
+ *    is allocated. Per-tick cost is proportional to the number of chords.
+ *  - Up to 32 chords per detector (fired mask is one word).
+ */
+
+#pragma once
+#include "ButtonDebounceBank.h"
+
+template <size_t N, size_t C>
+class ChordDetector {
+    static_assert(C >= 1u && C <= 32u, "ChordDetector supports 1..32 chords");
+
+public:
+    static const size_t kButtons = N;
+    static const size_t kChords  = C;
+    static const size_t kWords   = (N + 31u) / 32u;
+
+    struct Chord {
+        uint32_t mask[kWords];   // member buttons (bit i = button i)
+        uint16_t window_ticks;   // max ticks from first to last member press
+    };
+
+    explicit ChordDetector(const Chord (&table)[C]) : table_(table) { reset(); }
+
+    // Call each tick after the bank has been updated
+    void update(const ButtonBank<N>& bank)
+    {
+        update(bank.downMask(), bank.pressedMask());
+    }
+
+    void update(const uint32_t* down, const uint32_t* pressed)
+    {
+        fired_ = 0u;
+
+        for (size_t c = 0; c < C; c++) {
+            const Chord& ch = table_[c];
+            State& st = state_[c];
+
+            // Window expiry
+            if (st.armed) {
+                if (st.elapsed < 0xFFFFu) st.elapsed++;
+                if (st.elapsed > ch.window_ticks) st.armed = false;
+            }
+
+            uint32_t hit = 0u, lost = 0u, missing = 0u, up = 0u;
+            for (size_t w = 0; w < kWords; w++) hit |= pressed[w] & ch.mask[w];
+
+            if (hit && !st.armed) {
+                st.armed = true;
+                st.elapsed = 0u;
+                for (size_t w = 0; w < kWords; w++) st.seen[w] = 0u;
+            }
+            if (!st.armed) continue;
+
+            for (size_t w = 0; w < kWords; w++) {
+                st.seen[w] |= pressed[w] & ch.mask[w];
+                lost    |= st.seen[w] & ~down[w];
+                missing |= ch.mask[w] & ~st.seen[w];
+                up      |= ch.mask[w] & ~down[w];
+            }
+
+            if (lost) {
+                st.armed = false;
+            } else if (!missing && !up) {
+                st.armed = false;
+                fired_ |= 1u << c;
+            }
+        }
+    }
+
+    void reset()
+    {
+        fired_ = 0u;
+        for (size_t c = 0; c < C; c++) {
+            state_[c].armed = false;
+            state_[c].elapsed = 0u;
+            for (size_t w = 0; w < kWords; w++) state_[c].seen[w] = 0u;
+        }
+    }
+
+    // Chords completed on the last update() (bit c = table entry c)
+    uint32_t firedMask() const { return fired_; }
+    bool fired(size_t c) const { return ((fired_ >> c) & 1u) != 0u; }
+
+private:
+    struct State {
+        uint32_t seen[kWords];   // members pressed since the chord armed
+        uint16_t elapsed;        // ticks since the first member press
+        bool     armed;
+    };
+
+    const Chord* table_;
+    State        state_[C];
+    uint32_t     fired_;
+};
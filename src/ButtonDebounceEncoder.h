@@ -0,0 +1,331 @@
+/**
+ * ButtonDebounce - Quadrature Rotary Encoders
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * Table-driven decoding of mechanical rotary encoders, sampled on the same
+ * tick as the buttons. The two channels form a Gray code, so contact
+ * bounce on one channel only toggles between two neighbouring phases and
+ * cancels itself out (+1, -1, +1, ...). Sub-steps are counted per detent
+ * and a step is reported only once a full detent's worth has accumulated,
+ * which is all the debouncing an encoder needs.
+ *
+ * QuadratureDecoder:
+ * - 16-entry transition table indexed by (previous AB << 2) | current AB:
+ *   +1 / -1 for a valid quarter step, 0 for no change
+ * - Both channels changing in one tick is invalid (a missed sample or a
+ *   glitch): it moves nothing and is reported by invalid()
+ * - step() is +1 / -1 on the tick a detent completes (A leading B = +1)
+ * - velocity() is detents per tick in Q16.16, from the time between
+ *   detents; it decays while the shaft is idle and reads 0 after
+ *   velocity_timeout ticks without a detent
+ *
+ * EncoderBank<N>:
+ * - The same decoder for N encoders from two port words per 32 encoders
+ *   (one for the A channels, one for the B channels). The table reduces
+ *   to bitwise form: a valid step has exactly one channel changed, and
+ *   its direction is previous A XOR current B.
+ *
+ * Usage:
+ *   QuadratureDecoder knob;             // cfg.steps_per_detent = 4
+ *   knob.updateActiveLow(digitalRead(A_PIN), digitalRead(B_PIN));
+ *   volume += knob.step();
+ *
+ *   EncoderBank<32> knobs;
+ *   uint32_t a = readPortA(), b = readPortB();
+ *   knobs.updateActiveLow(&a, &b);
+ *   int32_t pos = knobs.position(3);
+ *
+ * Notes:
+ *  - Same tick contract as ButtonDebounce: one update() per tick, step()
+ *    and invalid() are one-shot until the next update(). The first
+ *    update() after reset() only latches the phase.
+ *  - steps_per_detent: 4 for full-cycle detents (most panel encoders),
+ *    2 for half-cycle, 1 for no detents. Both classes clamp it to 1..7
+ *    (the bank's 4-bit sliced counter holds 2 * 7). The tick must be fast
+ *    enough that the phase changes at most once per tick, or turns show
+ *    up as invalid transitions.
+ */
+
+#pragma once
+#include "ButtonDebounceBank.h"
+#include "ButtonDebounceBitSlice.h"
+#include "ButtonDebounceProfile.h"
+#include <stdint.h>
+#include <stddef.h>
+
+class QuadratureDecoder {
+public:
+    struct Config {
+        uint8_t  steps_per_detent = 4;     // quarter steps per reported step (1..7)
+        uint16_t velocity_timeout = 100;   // idle ticks until velocity() is 0 (~500ms @ 5ms)
+    };
+
+    // Config as used: steps_per_detent clamped to 1..7
+    static Config clamped(Config cfg)
+    {
+        if (cfg.steps_per_detent < 1u) cfg.steps_per_detent = 1u;
+        if (cfg.steps_per_detent > 7u) cfg.steps_per_detent = 7u;
+        return cfg;
+    }
+
+    // Transition table: (previous AB << 2) | current AB -> quarter step
+    static int8_t transition(uint8_t index)
+    {
+        static const int8_t kTable[16] = {
+             0, -1, +1,  0,     // from 00
+            +1,  0,  0, -1,     // from 01
+            -1,  0,  0, +1,     // from 10
+             0, +1, -1,  0      // from 11
+        };
+        return kTable[index & 15u];
+    }
+
+    QuadratureDecoder() : QuadratureDecoder(Config()) {}
+    explicit QuadratureDecoder(const Config& cfg) : cfg_(clamped(cfg)) { reset(); }
+
+    // Call each tick with both channel states (true = contact closed)
+    void update(bool a, bool b)
+    {
+        const uint8_t phase = (uint8_t)((a ? 2u : 0u) | (b ? 1u : 0u));
+        const uint8_t index = (uint8_t)((phase_ << 2) | phase);
+
+        now_++;
+        step_ = 0;
+        invalid_ = primed_ && (phase ^ phase_) == 3u;
+        if (invalid_ && invalid_count_ < 0xFFFFu) invalid_count_++;
+
+        const int8_t q = primed_ ? transition(index) : (int8_t)0;
+        phase_ = phase;
+        primed_ = true;
+        if (q == 0) return;
+
+        sub_ = (int8_t)(sub_ + q);
+        if (sub_ > -(int8_t)cfg_.steps_per_detent && sub_ < (int8_t)cfg_.steps_per_detent) return;
+
+        sub_ = 0;
+        step_ = q;
+        position_ += q;
+        noteDetent(q);
+    }
+
+    // Convenience for pull-up wiring (contact closed when the pin reads 0)
+    void updateActiveLow(bool a_pin_high, bool b_pin_high) { update(!a_pin_high, !b_pin_high); }
+
+    // One-shot: +1 / -1 when a detent completed this tick, else 0
+    int8_t step() const { return step_; }
+
+    // One-shot: both channels changed this tick (ignored)
+    bool invalid() const { return invalid_; }
+
+    // Invalid transitions since reset() (saturating)
+    uint16_t invalidCount() const { return invalid_count_; }
+
+    // Detents since reset()
+    int32_t position() const { return position_; }
+    void setPosition(int32_t pos) { position_ = pos; }
+
+    // Detents per tick, Q16.16 (65536 = one detent every tick; signed)
+    int32_t velocity() const
+    {
+        return encoderVelocity(dir_, interval_, now_ - last_, cfg_.velocity_timeout);
+    }
+
+    // Current channel phase, (A << 1) | B
+    uint8_t phase() const { return phase_; }
+
+    // Reset position, velocity and sub-step count; the next update()
+    // latches the phase without stepping
+    void reset()
+    {
+        position_ = 0;
+        now_ = 0u;
+        last_ = 0u;
+        interval_ = 0u;
+        invalid_count_ = 0u;
+        sub_ = 0;
+        step_ = 0;
+        dir_ = 0;
+        phase_ = 0u;
+        primed_ = false;
+        invalid_ = false;
+    }
+
+    // Shared by the bank: signed Q16.16 rate from the last detent interval,
+    // stretched to the time since that detent while the shaft is idle
+    static int32_t encoderVelocity(int8_t dir, uint16_t interval, uint32_t since, uint16_t timeout)
+    {
+        if (dir == 0 || since >= timeout) return 0;
+        const uint32_t span = (since > interval) ? since : interval;
+        const int32_t rate = (int32_t)(65536u / (span ? span : 1u));
+        return (dir > 0) ? rate : -rate;
+    }
+
+private:
+    void noteDetent(int8_t dir)
+    {
+        const uint32_t since = now_ - last_;
+        interval_ = (uint16_t)((dir_ == 0 || since >= cfg_.velocity_timeout) ? cfg_.velocity_timeout : since);
+        last_ = now_;
+        dir_ = dir;
+    }
+
+    Config   cfg_;
+    int32_t  position_;
+    uint32_t now_;             // ticks since reset()
+    uint32_t last_;            // tick of the last detent
+    uint16_t interval_;        // ticks between the last two detents
+    uint16_t invalid_count_;
+    int8_t   sub_;             // quarter steps toward the next detent
+    int8_t   step_;
+    int8_t   dir_;             // direction of the last detent (0 = none yet)
+    uint8_t  phase_;
+    bool     primed_;
+    bool     invalid_;
+};
+
+template <size_t N>
+class EncoderBank {
+public:
+    static const size_t kEncoders = N;
+    static const size_t kWords    = (N + 31u) / 32u;
+
+    EncoderBank() : EncoderBank(QuadratureDecoder::Config()) {}
+    explicit EncoderBank(const QuadratureDecoder::Config& cfg)
+        : cfg_(QuadratureDecoder::clamped(cfg)) { reset(); }
+
+    // Call each tick. a[w] / b[w] bit k = channel A / B of encoder
+    // (w*32 + k) closed.
+    void update(const uint32_t* a, const uint32_t* b) { updateWords(a, b, 0u); }
+
+    // Convenience for pull-up wiring (contact closed when the port bit reads 0)
+    void updateActiveLow(const uint32_t* a_port, const uint32_t* b_port)
+    {
+        updateWords(a_port, b_port, 0xFFFFFFFFu);
+    }
+
+    // Masks from the last update() (bit i = encoder i)
+    const uint32_t* forwardMask()  const { return fwd_; }    // step() == +1
+    const uint32_t* backwardMask() const { return back_; }   // step() == -1
+    const uint32_t* invalidMask()  const { return invalid_; }
+
+    int8_t step(size_t i) const
+    {
+        const uint32_t bit = 1u << (i & 31u);
+        return (fwd_[i >> 5] & bit) ? (int8_t)1 : ((back_[i >> 5] & bit) ? (int8_t)-1 : (int8_t)0);
+    }
+    bool invalid(size_t i) const { return ((invalid_[i >> 5] >> (i & 31u)) & 1u) != 0u; }
+
+    int32_t position(size_t i) const { return position_[i]; }
+    void setPosition(size_t i, int32_t pos) { position_[i] = pos; }
+
+    // Detents per tick, Q16.16, as QuadratureDecoder::velocity()
+    int32_t velocity(size_t i) const
+    {
+        return QuadratureDecoder::encoderVelocity(dir_[i], interval_[i], now_ - last_[i], cfg_.velocity_timeout);
+    }
+
+#if defined(BUTTON_DEBOUNCE_PROFILE)
+    // Cycles per bank tick (see ButtonDebounceProfile.h)
+    const ProfileStats& profile() const { return profile_; }
+    void resetProfile() { profile_.reset(); }
+#endif
+
+    // Reset every encoder; the next update() latches the phases
+    void reset()
+    {
+        now_ = 0u;
+        primed_ = false;
+        for (size_t w = 0; w < kWords; w++) {
+            a_[w] = 0u;
+            b_[w] = 0u;
+            fwd_[w] = 0u;
+            back_[w] = 0u;
+            invalid_[w] = 0u;
+            sub_[w].set(0xFFFFFFFFu, cfg_.steps_per_detent);
+        }
+        for (size_t i = 0; i < N; i++) {
+            position_[i] = 0;
+            last_[i] = 0u;
+            interval_[i] = 0u;
+            dir_[i] = 0;
+        }
+    }
+
+private:
+    static uint32_t laneMask(size_t w)
+    {
+        const size_t lanes = N - w * 32u;
+        return (lanes >= 32u) ? 0xFFFFFFFFu : ((1u << lanes) - 1u);
+    }
+
+    void updateWords(const uint32_t* a_port, const uint32_t* b_port, uint32_t flip)
+    {
+        BUTTON_DEBOUNCE_PROFILE_SCOPE(profile_);
+
+        now_++;
+        const uint32_t spd = cfg_.steps_per_detent;
+
+        for (size_t w = 0; w < kWords; w++) {
+            const uint32_t lanes = laneMask(w);
+            const uint32_t a = (a_port[w] ^ flip) & lanes;
+            const uint32_t b = (b_port[w] ^ flip) & lanes;
+            const uint32_t da = primed_ ? (a ^ a_[w]) : 0u;
+            const uint32_t db = primed_ ? (b ^ b_[w]) : 0u;
+
+            // Bitwise form of the transition table
+            const uint32_t valid = da ^ db;
+            const uint32_t back  = a_[w] ^ b;
+            invalid_[w] = da & db;
+            a_[w] = a;
+            b_[w] = b;
+
+            // Sub-steps offset by spd: 0 and 2*spd are a full detent
+            sub_[w].increment(valid & ~back);
+            sub_[w].decrement(valid & back);
+            fwd_[w]  = sub_[w].equals(2u * spd) & lanes;
+            back_[w] = sub_[w].equals(0u) & lanes;
+            sub_[w].set(fwd_[w] | back_[w], spd);
+
+            // Positions and timing only for lanes that stepped
+            uint32_t m = fwd_[w] | back_[w];
+            while (m) {
+                const unsigned k = bankLowestBit(m);
+                m &= m - 1u;
+                noteDetent(w * 32u + k, ((fwd_[w] >> k) & 1u) ? (int8_t)1 : (int8_t)-1);
+            }
+        }
+        primed_ = true;
+    }
+
+    void noteDetent(size_t i, int8_t dir)
+    {
+        const uint32_t since = now_ - last_[i];
+        interval_[i] = (uint16_t)((dir_[i] == 0 || since >= cfg_.velocity_timeout) ? cfg_.velocity_timeout : since);
+        last_[i] = now_;
+        dir_[i] = dir;
+        position_[i] += dir;
+    }
+
+    QuadratureDecoder::Config cfg_;
+    uint32_t now_;     // ticks since reset()
+    bool     primed_;
+
+    uint32_t a_[kWords];             // previous channel A / B samples
+    uint32_t b_[kWords];
+    SlicedCounter<4> sub_[kWords];   // quarter steps + steps_per_detent, per lane
+    uint32_t fwd_[kWords];
+    uint32_t back_[kWords];
+    uint32_t invalid_[kWords];
+
+    int32_t  position_[N];
+    uint32_t last_[N];       // tick of the last detent
+    uint16_t interval_[N];   // ticks between the last two detents
+    int8_t   dir_[N];
+
+#if defined(BUTTON_DEBOUNCE_PROFILE)
+    ProfileStats profile_;
+#endif
+};
@@ -0,0 +1,237 @@
+/**
+ * ButtonDebounce - Gesture Layer
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * Click, double-click, long-press and auto-repeat on top of the debounced
+ * pressed()/released()/down() stream.
+ *
+ * Usage:
+ *   GestureDetector::Config gc;
+ *   gc.long_ticks = 100;           // 500 ms @ 5 ms
+ *   GestureDetector gesture(gc);
+ *
+ *   btn.update(raw);
+ *   switch (gesture.update(btn)) {
+ *       case GestureDetector::Click:       ...
+ *       case GestureDetector::DoubleClick: ...
+ *       case GestureDetector::LongPress:   ...
+ *       case GestureDetector::Repeat:      ...
+ *       default: break;
+ *   }
+ *
+ * Timing (all in ticks, 0 disables the gesture):
+ *  - LongPress fires long_ticks after the press while still held.
+ *  - Repeat fires every repeat_ticks after a LongPress while still held.
+ *  - A release that was not a long press is a Click, unless a second
+ *    press follows within multi_gap_ticks, which makes it a DoubleClick.
+ *    With multi_gap_ticks = 0 clicks are reported on release, no waiting.
+ *
+ * Notes:
+ *  - Feed one-shot (non-latched) events, exactly one update() per tick.
+ *  - Per-button state is 3 bytes: one 16-bit tick counter + flags.
+ *  - GestureBank<N> implements the same rules over a whole ButtonBank
+ *    with bit-sliced counters and mask operations.
+ */
+
+#pragma once
+#include "ButtonDebounceBank.h"
+#include "ButtonDebounceBitSlice.h"
+
+class GestureDetector {
+public:
+    enum Event : uint8_t {
+        None = 0,
+        Click,
+        DoubleClick,
+        LongPress,
+        Repeat
+    };
+
+    struct Config {
+        uint16_t long_ticks      = 100;  // hold time for LongPress (500ms @ 5ms)
+        uint16_t repeat_ticks    = 20;   // Repeat period after LongPress (100ms @ 5ms)
+        uint16_t multi_gap_ticks = 50;   // max release->press gap for DoubleClick
+    };
+
+    GestureDetector() : GestureDetector(Config()) {}
+    explicit GestureDetector(const Config& cfg) : cfg_(cfg) { reset(); }
+
+    // Call each tick after the button has been updated
+    Event update(const ButtonDebounce& btn)
+    {
+        return update(btn.pressed(), btn.released(), btn.down());
+    }
+
+    Event update(bool pressed, bool released, bool down)
+    {
+        Event ev = None;
+
+        if (pressed) {
+            timer_ = 0u;
+            flags_ &= (uint8_t)~kLong;
+        } else if (released) {
+            if (!(flags_ & kLong)) {
+                if (flags_ & kPending) {
+                    flags_ &= (uint8_t)~kPending;
+                    ev = DoubleClick;
+                } else if (cfg_.multi_gap_ticks == 0u) {
+                    ev = Click;
+                } else {
+                    flags_ |= kPending;
+                }
+            }
+            timer_ = 0u;
+        } else {
+            if (timer_ != 0xFFFFu) timer_++;
+
+            if (down) {
+                if (!(flags_ & kLong)) {
+                    if (cfg_.long_ticks != 0u && timer_ == cfg_.long_ticks) {
+                        flags_ = (uint8_t)((flags_ | kLong) & ~kPending);
+                        timer_ = 0u;
+                        ev = LongPress;
+                    }
+                } else if (cfg_.repeat_ticks != 0u && timer_ == cfg_.repeat_ticks) {
+                    timer_ = 0u;
+                    ev = Repeat;
+                }
+            } else if ((flags_ & kPending) && timer_ == cfg_.multi_gap_ticks) {
+                flags_ &= (uint8_t)~kPending;
+                ev = Click;
+            }
+        }
+
+        return ev;
+    }
+
+    void reset()
+    {
+        timer_ = 0u;
+        flags_ = 0u;
+    }
+
+private:
+    static const uint8_t kPending = 0x01u;  // one click waiting for a second press
+    static const uint8_t kLong    = 0x02u;  // LongPress already fired in this hold
+
+    Config   cfg_;
+    uint16_t timer_;
+    uint8_t  flags_;
+};
+
+/**
+ * GestureBank - GestureDetector rules for N buttons, 32 lanes per word.
+ *
+ * Each lane's tick counter lives in a 16-plane SlicedCounter, so the
+ * long-press, repeat and double-click timers for a whole word are
+ * advanced and compared with a fixed sequence of mask operations.
+ */
+template <size_t N>
+class GestureBank {
+public:
+    static const size_t kButtons = N;
+    static const size_t kWords   = (N + 31u) / 32u;
+
+    GestureBank() : GestureBank(GestureDetector::Config()) {}
+    explicit GestureBank(const GestureDetector::Config& cfg) : cfg_(cfg) { reset(); }
+
+    // Call each tick after the bank has been updated
+    void update(const ButtonBank<N>& bank)
+    {
+        update(bank.downMask(), bank.pressedMask(), bank.releasedMask());
+    }
+
+    void update(const uint32_t* down, const uint32_t* pressed, const uint32_t* released)
+    {
+        for (size_t w = 0; w < kWords; w++) {
+            SlicedCounter<16>& t = timer_[w];
+            const uint32_t pr = pressed[w];
+            const uint32_t rl = released[w];
+            const uint32_t dn = down[w];
+            const uint32_t idle = ~(pr | rl);
+
+            // Releases that were not long presses
+            const uint32_t rel_short = rl & ~long_[w];
+            const uint32_t dbl = rel_short & pending_[w];
+            uint32_t click = 0u;
+            if (cfg_.multi_gap_ticks == 0u) {
+                click = rel_short & ~pending_[w];
+            } else {
+                pending_[w] |= rel_short & ~pending_[w];
+            }
+            pending_[w] &= ~dbl;
+            long_[w] &= ~pr;
+
+            // Advance timers; presses and releases restart at 0
+            t.clear(pr | rl);
+            t.increment(idle);
+
+            // Held lanes: long press, then repeat
+            const uint32_t held = idle & dn;
+            uint32_t lp = 0u, rp = 0u;
+            if (cfg_.long_ticks != 0u)   lp = held & ~long_[w] & t.equals(cfg_.long_ticks);
+            if (cfg_.repeat_ticks != 0u) rp = held & long_[w] & t.equals(cfg_.repeat_ticks);
+            long_[w] |= lp;
+            pending_[w] &= ~lp;
+            t.clear(lp | rp);
+
+            // Released lanes waiting for a second press: gap timeout -> click
+            if (cfg_.multi_gap_ticks != 0u) {
+                const uint32_t to = idle & ~dn & pending_[w] & t.equals(cfg_.multi_gap_ticks);
+                pending_[w] &= ~to;
+                click |= to;
+            }
+
+            click_[w]  = click;
+            double_[w] = dbl;
+            longp_[w]  = lp;
+            repeat_[w] = rp;
+        }
+    }
+
+    void reset()
+    {
+        for (size_t w = 0; w < kWords; w++) {
+            timer_[w].clear(0xFFFFFFFFu);
+            pending_[w] = 0u;
+            long_[w] = 0u;
+            click_[w] = 0u;
+            double_[w] = 0u;
+            longp_[w] = 0u;
+            repeat_[w] = 0u;
+        }
+    }
+
+    // Event masks from the last update() (bit i = button i)
+    const uint32_t* clickMask()       const { return click_; }
+    const uint32_t* doubleClickMask() const { return double_; }
+    const uint32_t* longPressMask()   const { return longp_; }
+    const uint32_t* repeatMask()      const { return repeat_; }
+
+    // Event for a single button from the last update()
+    GestureDetector::Event event(size_t i) const
+    {
+        const size_t w = i >> 5;
+        const uint32_t bit = 1u << (i & 31u);
+        if (click_[w] & bit)  return GestureDetector::Click;
+        if (double_[w] & bit) return GestureDetector::DoubleClick;
+        if (longp_[w] & bit)  return GestureDetector::LongPress;
+        if (repeat_[w] & bit) return GestureDetector::Repeat;
+        return GestureDetector::None;
+    }
+
+private:
+    GestureDetector::Config cfg_;
+
+    SlicedCounter<16> timer_[kWords];
+    uint32_t pending_[kWords];
+    uint32_t long_[kWords];
+
+    uint32_t click_[kWords];
+    uint32_t double_[kWords];
+    uint32_t longp_[kWords];
+    uint32_t repeat_[kWords];
+};
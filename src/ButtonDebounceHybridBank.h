@@ -0,0 +1,157 @@
+/**
+ * ButtonDebounce - Hybrid Bank
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * The hybrid engine for whole port words at once. History is kept as bit
+ * planes, the edge count and timeout counter as bit-sliced counters, and
+ * the accumulators as bit-sliced integers with saturating add/subtract,
+ * so 32 buttons per word run the full filter with AND/XOR only.
+ *
+ * Usage:
+ *   HybridBank<64> keys;                    // uses integ_* / edge_threshold / unstable_timeout
+ *   uint32_t raw[HybridBank<64>::kWords] = { readPortA(), readPortB() };
+ *   keys.update(raw);
+ *   uint32_t hits = keys.pressedMask()[0];
+ *
+ * Notes:
+ *  - Header-only and independent of the engine .cpp in the build; it
+ *    produces the same events as buttonDebounceHybrid.cpp.
+ *  - No per-lane branch: every step runs for every word, so the cost of
+ *    update() does not depend on the input (as the constant-time engine).
+ */
+
+#pragma once
+#include "ButtonDebounce.h"
+#include "ButtonDebounceBitSlice.h"
+#include "ButtonDebounceProfile.h"
+#include <stddef.h>
+
+template <size_t N>
+class HybridBank {
+public:
+    static const size_t kButtons = N;
+    static const size_t kWords   = (N + 31u) / 32u;
+
+    HybridBank() : HybridBank(ButtonDebounce::Config()) {}
+    explicit HybridBank(const ButtonDebounce::Config& cfg) : cfg_(cfg) { reset(false); }
+
+    // Call each tick. raw_down[w] bit b = raw state of button (w*32 + b).
+    void update(const uint32_t* raw_down) { updateWords(raw_down, 0u); }
+
+    // Convenience for pull-up wiring (pressed when the port bit reads 0)
+    void updateActiveLow(const uint32_t* port) { updateWords(port, 0xFFFFFFFFu); }
+
+    // Masks from the last update() (bit i = button i)
+    const uint32_t* downMask()     const { return down_; }
+    const uint32_t* pressedMask()  const { return pressed_; }
+    const uint32_t* releasedMask() const { return released_; }
+
+    bool down(size_t i)     const { return ((down_[i >> 5]     >> (i & 31u)) & 1u) != 0u; }
+    bool pressed(size_t i)  const { return ((pressed_[i >> 5]  >> (i & 31u)) & 1u) != 0u; }
+    bool released(size_t i) const { return ((released_[i >> 5] >> (i & 31u)) & 1u) != 0u; }
+
+    // History byte of one button (LSB = newest), as ButtonDebounce::history()
+    uint8_t history(size_t i) const
+    {
+        uint8_t h = 0u;
+        for (unsigned k = 0; k < 8u; k++) {
+            h |= (uint8_t)(((plane_[(pos_ - k) & 7u][i >> 5] >> (i & 31u)) & 1u) << k);
+        }
+        return h;
+    }
+
+    // Accumulator of one button
+    uint32_t value(size_t i) const { return acc_[i >> 5].lane((unsigned)(i & 31u)); }
+
+#if defined(BUTTON_DEBOUNCE_PROFILE)
+    // Cycles per bank tick (see ButtonDebounceProfile.h)
+    const ProfileStats& profile() const { return profile_; }
+    void resetProfile() { profile_.reset(); }
+#endif
+
+    // Reset every button to a known debounced state
+    void reset(bool start_down = false)
+    {
+        pos_ = 0u;
+        for (size_t w = 0; w < kWords; w++) {
+            const uint32_t lvl = start_down ? laneMask(w) : 0u;
+            for (unsigned k = 0; k < 8u; k++) plane_[k][w] = lvl;
+            acc_[w].clear(0xFFFFFFFFu);
+            acc_[w].set(lvl, cfg_.integ_max);
+            unstable_[w].clear(0xFFFFFFFFu);
+            down_[w] = lvl;
+            pressed_[w] = 0u;
+            released_[w] = 0u;
+        }
+    }
+
+private:
+    static const unsigned kAccBits = 8u * sizeof(ButtonDebounce::IntegValue);
+
+    static uint32_t laneMask(size_t w)
+    {
+        const size_t lanes = N - w * 32u;
+        return (lanes >= 32u) ? 0xFFFFFFFFu : ((1u << lanes) - 1u);
+    }
+
+    void updateWords(const uint32_t* port, uint32_t flip)
+    {
+        BUTTON_DEBOUNCE_PROFILE_SCOPE(profile_);
+
+        pos_ = (uint8_t)((pos_ + 1u) & 7u);
+
+        for (size_t w = 0; w < kWords; w++) {
+            const uint32_t lanes = laneMask(w);
+            const uint32_t in = (port[w] ^ flip) & lanes;
+            plane_[pos_][w] = in;
+
+            // Edge count as edgeCount8(): adjacent-sample transitions plus
+            // the oldest sample
+            SlicedCounter<4> edges;
+            for (unsigned k = 0; k < 7u; k++) {
+                edges.increment(plane_[(pos_ - k) & 7u][w] ^ plane_[(pos_ - k - 1u) & 7u][w]);
+            }
+            edges.increment(plane_[(pos_ + 1u) & 7u][w]);
+
+            const uint32_t bouncing = edges.atLeast(cfg_.edge_threshold) & lanes;
+            unstable_[w].clear(~bouncing);
+            unstable_[w].increment(bouncing);
+            const uint32_t timeout = unstable_[w].atLeast(cfg_.unstable_timeout) & lanes;
+
+            // Saturating integrator on lanes that are neither bouncing nor recentering
+            const uint32_t live = lanes & ~bouncing & ~timeout;
+            acc_[w].add(live & in, cfg_.integ_up, cfg_.integ_max);
+            acc_[w].sub(live & ~in, cfg_.integ_down);
+
+            // Timeout -> recenter history and accumulator to the debounced level
+            for (unsigned k = 0; k < 8u; k++) {
+                plane_[k][w] = (plane_[k][w] & ~timeout) | (down_[w] & timeout);
+            }
+            unstable_[w].clear(timeout);
+            acc_[w].set(timeout & down_[w], cfg_.integ_max);
+            acc_[w].clear(timeout & ~down_[w]);
+
+            // Hysteresis thresholds (not on a recenter tick)
+            pressed_[w]  = ~down_[w] & acc_[w].atLeast(cfg_.integ_on) & ~timeout & lanes;
+            released_[w] = down_[w] & ~acc_[w].atLeast((uint32_t)cfg_.integ_off + 1u) & ~timeout;
+            down_[w] = (down_[w] | pressed_[w]) & ~released_[w];
+        }
+    }
+
+    ButtonDebounce::Config cfg_;
+    uint8_t pos_;   // plane holding the newest sample
+
+    uint32_t plane_[8][kWords];   // sample history, one plane per tick
+    SlicedCounter<kAccBits> acc_[kWords];
+    SlicedCounter<8> unstable_[kWords];
+    uint32_t down_[kWords];
+    uint32_t pressed_[kWords];
+    uint32_t released_[kWords];
+
+#if defined(BUTTON_DEBOUNCE_PROFILE)
+    ProfileStats profile_;
+#endif
+};
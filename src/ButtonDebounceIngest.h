@@ -0,0 +1,165 @@
+/**
+ * ButtonDebounce - DMA Sample Ingestion
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * Ping-pong (circular, two-halves) DMA buffer feeding a ButtonBank.
+ * The DMA engine fills one half with port samples while the CPU runs the
+ * bank over the other half in place: every sample is read exactly once,
+ * directly from the DMA buffer, and never copied.
+ *
+ * Buffer layout:
+ *   buffer[(half * frames_per_half + t) * kWords + w]
+ *   half 0 = first half, half 1 = second half, t = tick within the half,
+ *   w = port word (bit b of word w = button w*32 + b)
+ *
+ * Usage:
+ *   static uint32_t dma_buf[2 * 16 * ButtonBank<40>::kWords];
+ *   ButtonBank<40> bank;
+ *   BankIngest<40> ingest(bank, dma_buf, 16);   // 16 ticks per half
+ *
+ *   void DMA_IRQHandler() {
+ *       if (half_transfer)   ingest.onHalfComplete();
+ *       if (transfer_done)   ingest.onComplete();
+ *   }
+ *
+ *   void loop() {
+ *       ingest.process();    // runs the bank over every ready half, in order
+ *   }
+ *
+ * Notes:
+ *  - onHalfComplete()/onComplete() only bump a counter; they are safe to
+ *    call from the DMA ISR while process() runs in thread context.
+ *  - process() may also be called directly from the ISR.
+ *  - A half that becomes ready twice before it is processed has been
+ *    overwritten by the DMA; it is still processed once and counted in
+ *    overruns().
+ *  - The bank's own masks and snapshot describe only the last frame of a
+ *    batch. pressedMask()/releasedMask() here collect every press and
+ *    release from all frames run by the last process() call, so no edge
+ *    is lost when several frames are processed at once.
+ *  - With an event handler set, it is also called after every frame that
+ *    produced a press or release, with the bank's masks for that frame.
+ */
+
+#pragma once
+#include "ButtonDebounceBank.h"
+
+template <size_t N>
+class BankIngest {
+public:
+    typedef ButtonBank<N> Bank;
+    static const size_t kWords = Bank::kWords;
+
+    // Called after a frame that produced at least one event
+    typedef void (*EventHandler)(const Bank& bank, void* ctx);
+
+    BankIngest(Bank& bank, const uint32_t* buffer, size_t frames_per_half,
+               bool active_low = false)
+        : bank_(bank),
+          buffer_(buffer),
+          frames_per_half_(frames_per_half),
+          active_low_(active_low),
+          handler_(0),
+          handler_ctx_(0)
+    {
+        reset();
+    }
+
+    // DMA hooks (ISR context)
+    void onHalfComplete() { ready_[0] = (uint8_t)(ready_[0] + 1u); }
+    void onComplete()     { ready_[1] = (uint8_t)(ready_[1] + 1u); }
+
+    // Run the bank over every completed half, oldest first.
+    // Returns the number of frames (ticks) processed.
+    size_t process()
+    {
+        size_t frames = 0;
+
+        for (size_t w = 0; w < kWords; w++) {
+            pressed_[w] = 0u;
+            released_[w] = 0u;
+        }
+
+        for (;;) {
+            const uint8_t h = next_half_;
+            const uint8_t ready = ready_[h];   // one read: the ISR may bump it meanwhile
+            const uint8_t pending = (uint8_t)(ready - done_[h]);
+            if (pending == 0u) break;
+
+            if (pending > 1u) overruns_++;
+            done_[h] = ready;
+
+            const uint32_t* half = buffer_ + (size_t)h * frames_per_half_ * kWords;
+            runHalf(half);
+            frames += frames_per_half_;
+
+            next_half_ = (uint8_t)(h ^ 1u);
+        }
+
+        return frames;
+    }
+
+    void setEventHandler(EventHandler handler, void* ctx = 0)
+    {
+        handler_ = handler;
+        handler_ctx_ = ctx;
+    }
+
+    // Every press / release in the frames run by the last process() call
+    // (a button that pressed and released within the batch is in both)
+    const uint32_t* pressedMask()  const { return pressed_; }
+    const uint32_t* releasedMask() const { return released_; }
+
+    // Halves overwritten by the DMA before process() reached them
+    uint32_t overruns() const { return overruns_; }
+
+    // Forget pending halves; the next half expected is the first one
+    void reset()
+    {
+        ready_[0] = ready_[1] = 0u;
+        done_[0] = done_[1] = 0u;
+        next_half_ = 0u;
+        overruns_ = 0u;
+        for (size_t w = 0; w < kWords; w++) {
+            pressed_[w] = 0u;
+            released_[w] = 0u;
+        }
+    }
+
+private:
+    void runHalf(const uint32_t* half)
+    {
+        for (size_t t = 0; t < frames_per_half_; t++) {
+            bank_.updateFrames(half + t * kWords, 1u, active_low_);
+
+            uint32_t any = 0u;
+            for (size_t w = 0; w < kWords; w++) {
+                const uint32_t pr = bank_.pressedMask()[w];
+                const uint32_t rl = bank_.releasedMask()[w];
+                pressed_[w] |= pr;
+                released_[w] |= rl;
+                any |= pr | rl;
+            }
+            if (any && handler_) handler_(bank_, handler_ctx_);
+        }
+    }
+
+    Bank&           bank_;
+    const uint32_t* buffer_;
+    size_t          frames_per_half_;
+    bool            active_low_;
+
+    EventHandler handler_;
+    void*        handler_ctx_;
+
+    volatile uint8_t ready_[2];   // written by the DMA hooks
+    uint8_t          done_[2];    // written by process()
+    uint8_t          next_half_;
+    uint32_t         overruns_;
+
+    uint32_t pressed_[kWords];    // events collected by process()
+    uint32_t released_[kWords];
+};
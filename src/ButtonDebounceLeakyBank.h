@@ -0,0 +1,199 @@
+/**
+ * ButtonDebounce - Leaky Integrator Bank
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * The leaky engine for whole port words at once. Averages are stored
+ * structure-of-arrays (one uint16_t per button, contiguous) and updated
+ * in 16-bit SIMD lanes; port bits are expanded to lane masks in-register.
+ *
+ * Paths (selected at compile time):
+ * - AVX2:    16 buttons per step
+ * - SSE2:     8 buttons per step
+ * - Scalar fallback
+ * All paths produce bit-identical results to buttonDebounceLeaky.cpp.
+ *
+ * Usage:
+ *   LeakyBank<1024> keys;                   // uses leak_shift/leak_on/leak_off
+ *   keys.update(port_words);                // bit i of the words = button i
+ *   uint32_t hits = keys.pressedMask()[0];
+ *
+ * Notes:
+ *  - Header-only and independent of the engine .cpp in the build.
+ *  - Per step: a raw sample of 1 adds (~y) >> shift, a 0 subtracts
+ *    y >> shift. Both use the same logical shift, selected per lane
+ *    with XOR masks, so no multiply and no per-lane branch.
+ *  - Define BUTTON_DEBOUNCE_NO_SIMD to force the scalar path.
+ */
+
+#pragma once
+#include "ButtonDebounce.h"
+#include "ButtonDebounceProfile.h"
+#include <stddef.h>
+
+#if !defined(BUTTON_DEBOUNCE_NO_SIMD)
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define BUTTON_DEBOUNCE_LEAKY_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define BUTTON_DEBOUNCE_LEAKY_SSE2 1
+#endif
+#endif
+
+template <size_t N>
+class LeakyBank {
+public:
+    static const size_t kButtons = N;
+    static const size_t kWords   = (N + 31u) / 32u;
+
+    LeakyBank() : LeakyBank(ButtonDebounce::Config()) {}
+    explicit LeakyBank(const ButtonDebounce::Config& cfg) : cfg_(cfg) { reset(false); }
+
+    // Call each tick. raw_down[w] bit b = raw state of button (w*32 + b).
+    void update(const uint32_t* raw_down) { updateWords(raw_down, 0u); }
+
+    // Convenience for pull-up wiring (pressed when the port bit reads 0)
+    void updateActiveLow(const uint32_t* port) { updateWords(port, 0xFFFFFFFFu); }
+
+    // Masks from the last update() (bit i = button i)
+    const uint32_t* downMask()     const { return down_; }
+    const uint32_t* pressedMask()  const { return pressed_; }
+    const uint32_t* releasedMask() const { return released_; }
+
+    bool down(size_t i)     const { return ((down_[i >> 5]     >> (i & 31u)) & 1u) != 0u; }
+    bool pressed(size_t i)  const { return ((pressed_[i >> 5]  >> (i & 31u)) & 1u) != 0u; }
+    bool released(size_t i) const { return ((released_[i >> 5] >> (i & 31u)) & 1u) != 0u; }
+
+    // Q0.16 average of one button
+    uint16_t value(size_t i) const { return value_[i]; }
+
+#if defined(BUTTON_DEBOUNCE_PROFILE)
+    // Cycles per bank tick (see ButtonDebounceProfile.h)
+    const ProfileStats& profile() const { return profile_; }
+    void resetProfile() { profile_.reset(); }
+#endif
+
+    // Reset every button to a known debounced state
+    void reset(bool start_down = false)
+    {
+        for (size_t i = 0; i < kPadded; i++) value_[i] = start_down ? 0xFFFFu : 0u;
+        for (size_t w = 0; w < kWords; w++) {
+            down_[w] = start_down ? laneMask(w) : 0u;
+            pressed_[w] = 0u;
+            released_[w] = 0u;
+        }
+    }
+
+private:
+    static const size_t kPadded = (N + 15u) & ~(size_t)15u;
+
+    static uint32_t laneMask(size_t w)
+    {
+        const size_t lanes = N - w * 32u;
+        return (lanes >= 32u) ? 0xFFFFFFFFu : ((1u << lanes) - 1u);
+    }
+
+    void updateWords(const uint32_t* port, uint32_t flip)
+    {
+        BUTTON_DEBOUNCE_PROFILE_SCOPE(profile_);
+
+        uint32_t hi[kWords];   // value >= leak_on
+        uint32_t lo[kWords];   // value <= leak_off
+        for (size_t w = 0; w < kWords; w++) {
+            hi[w] = 0u;
+            lo[w] = 0u;
+        }
+
+        size_t i = 0;
+#if defined(BUTTON_DEBOUNCE_LEAKY_AVX2)
+        {
+            const __m128i sh   = _mm_cvtsi32_si128(cfg_.leak_shift);
+            const __m256i ones = _mm256_set1_epi16(-1);
+            const __m256i bias = _mm256_set1_epi16((int16_t)0x8000);
+            const __m256i on   = _mm256_set1_epi16((int16_t)(cfg_.leak_on ^ 0x8000u));
+            const __m256i off  = _mm256_set1_epi16((int16_t)(cfg_.leak_off ^ 0x8000u));
+            const __m256i sel  = _mm256_setr_epi16(
+                0x0001, 0x0002, 0x0004, 0x0008, 0x0010, 0x0020, 0x0040, 0x0080,
+                0x0100, 0x0200, 0x0400, 0x0800, 0x1000, 0x2000, 0x4000, (int16_t)0x8000);
+            for (; i < N - N % 16u; i += 16u) {
+                const uint32_t bits = ((port[i >> 5] ^ flip) >> (i & 31u)) & 0xFFFFu;
+                const __m256i m  = _mm256_cmpeq_epi16(
+                    _mm256_and_si256(_mm256_set1_epi16((int16_t)bits), sel), sel);
+                const __m256i nm = _mm256_xor_si256(m, ones);
+
+                // d = (raw ? ~y : y) >> shift; y += raw ? d : -d
+                __m256i y = _mm256_loadu_si256((const __m256i*)(value_ + i));
+                const __m256i d = _mm256_srl_epi16(_mm256_xor_si256(y, m), sh);
+                y = _mm256_add_epi16(y, _mm256_sub_epi16(_mm256_xor_si256(d, nm), nm));
+                _mm256_storeu_si256((__m256i*)(value_ + i), y);
+
+                // Unsigned compares via the sign-bias trick; on > y and y > off
+                // are the complements of the wanted masks
+                const __m256i yb = _mm256_xor_si256(y, bias);
+                const uint32_t h = (uint32_t)_mm256_movemask_epi8(
+                    _mm256_packs_epi16(_mm256_cmpgt_epi16(on, yb), _mm256_setzero_si256()));
+                const uint32_t l = (uint32_t)_mm256_movemask_epi8(
+                    _mm256_packs_epi16(_mm256_cmpgt_epi16(yb, off), _mm256_setzero_si256()));
+                // packs interleaves 128-bit halves: lanes 0-7 in bits 0-7, 8-15 in bits 16-23
+                hi[i >> 5] |= (~((h & 0xFFu) | ((h >> 8) & 0xFF00u)) & 0xFFFFu) << (i & 31u);
+                lo[i >> 5] |= (~((l & 0xFFu) | ((l >> 8) & 0xFF00u)) & 0xFFFFu) << (i & 31u);
+            }
+        }
+#elif defined(BUTTON_DEBOUNCE_LEAKY_SSE2)
+        {
+            const __m128i sh   = _mm_cvtsi32_si128(cfg_.leak_shift);
+            const __m128i ones = _mm_set1_epi16(-1);
+            const __m128i bias = _mm_set1_epi16((int16_t)0x8000);
+            const __m128i on   = _mm_set1_epi16((int16_t)(cfg_.leak_on ^ 0x8000u));
+            const __m128i off  = _mm_set1_epi16((int16_t)(cfg_.leak_off ^ 0x8000u));
+            const __m128i sel  = _mm_setr_epi16(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80);
+            for (; i < N - N % 8u; i += 8u) {
+                const uint32_t bits = ((port[i >> 5] ^ flip) >> (i & 31u)) & 0xFFu;
+                const __m128i m  = _mm_cmpeq_epi16(
+                    _mm_and_si128(_mm_set1_epi16((int16_t)bits), sel), sel);
+                const __m128i nm = _mm_xor_si128(m, ones);
+
+                __m128i y = _mm_loadu_si128((const __m128i*)(value_ + i));
+                const __m128i d = _mm_srl_epi16(_mm_xor_si128(y, m), sh);
+                y = _mm_add_epi16(y, _mm_sub_epi16(_mm_xor_si128(d, nm), nm));
+                _mm_storeu_si128((__m128i*)(value_ + i), y);
+
+                const __m128i yb = _mm_xor_si128(y, bias);
+                const uint32_t h = (uint32_t)_mm_movemask_epi8(
+                    _mm_packs_epi16(_mm_cmpgt_epi16(on, yb), _mm_setzero_si128()));
+                const uint32_t l = (uint32_t)_mm_movemask_epi8(
+                    _mm_packs_epi16(_mm_cmpgt_epi16(yb, off), _mm_setzero_si128()));
+                hi[i >> 5] |= (~h & 0xFFu) << (i & 31u);
+                lo[i >> 5] |= (~l & 0xFFu) << (i & 31u);
+            }
+        }
+#endif
+        for (; i < N; i++) {
+            const bool raw = (((port[i >> 5] ^ flip) >> (i & 31u)) & 1u) != 0u;
+            value_[i] = ButtonDebounce::leakyStep(value_[i], raw, cfg_.leak_shift);
+            hi[i >> 5] |= (uint32_t)(value_[i] >= cfg_.leak_on)  << (i & 31u);
+            lo[i >> 5] |= (uint32_t)(value_[i] <= cfg_.leak_off) << (i & 31u);
+        }
+
+        // Hysteresis on whole words
+        for (size_t w = 0; w < kWords; w++) {
+            pressed_[w]  = ~down_[w] & hi[w];
+            released_[w] = down_[w] & lo[w];
+            down_[w] = (down_[w] | pressed_[w]) & ~released_[w];
+        }
+    }
+
+    ButtonDebounce::Config cfg_;
+
+    alignas(32) uint16_t value_[kPadded];
+    uint32_t down_[kWords];
+    uint32_t pressed_[kWords];
+    uint32_t released_[kWords];
+
+#if defined(BUTTON_DEBOUNCE_PROFILE)
+    ProfileStats profile_;
+#endif
+};
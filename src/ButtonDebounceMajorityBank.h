@@ -0,0 +1,129 @@
+/**
+ * ButtonDebounce - Majority Bank
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * The majority engine's vote for whole port words at once. Sample
+ * history is kept as bit planes (one word per tick, one lane per
+ * button), and the votes are summed with bit-sliced adders into a 4-bit
+ * sliced count, so 32 buttons per word are debounced with AND/XOR only.
+ *
+ * Usage:
+ *   MajorityBank<64> keys;                  // uses maj_window/maj_on/maj_off
+ *   uint32_t raw[MajorityBank<64>::kWords] = { readPortA(), readPortB() };
+ *   keys.update(raw);
+ *   uint32_t hits = keys.pressedMask()[0];
+ *
+ * Notes:
+ *  - Header-only and independent of the engine .cpp in the build; it
+ *    produces the same events as buttonDebounceMajority.cpp.
+ *  - Per-button cost is 8 history bits; update() costs about
+ *    maj_window * 4 word operations per 32 buttons.
+ */
+
+#pragma once
+#include "ButtonDebounce.h"
+#include "ButtonDebounceBitSlice.h"
+#include "ButtonDebounceProfile.h"
+#include <stddef.h>
+
+template <size_t N>
+class MajorityBank {
+public:
+    static const size_t kButtons = N;
+    static const size_t kWords   = (N + 31u) / 32u;
+
+    MajorityBank() : MajorityBank(ButtonDebounce::Config()) {}
+    explicit MajorityBank(const ButtonDebounce::Config& cfg) : cfg_(cfg)
+    {
+        window_ = (cfg_.maj_window == 0u || cfg_.maj_window > 8u) ? 8u : cfg_.maj_window;
+        reset(false);
+    }
+
+    // Call each tick. raw_down[w] bit b = raw state of button (w*32 + b).
+    void update(const uint32_t* raw_down) { updateWords(raw_down, 0u); }
+
+    // Convenience for pull-up wiring (pressed when the port bit reads 0)
+    void updateActiveLow(const uint32_t* port) { updateWords(port, 0xFFFFFFFFu); }
+
+    // Masks from the last update() (bit i = button i)
+    const uint32_t* downMask()     const { return down_; }
+    const uint32_t* pressedMask()  const { return pressed_; }
+    const uint32_t* releasedMask() const { return released_; }
+
+    bool down(size_t i)     const { return ((down_[i >> 5]     >> (i & 31u)) & 1u) != 0u; }
+    bool pressed(size_t i)  const { return ((pressed_[i >> 5]  >> (i & 31u)) & 1u) != 0u; }
+    bool released(size_t i) const { return ((released_[i >> 5] >> (i & 31u)) & 1u) != 0u; }
+
+    // History byte of one button (LSB = newest), as ButtonDebounce::history()
+    uint8_t history(size_t i) const
+    {
+        uint8_t h = 0u;
+        for (unsigned k = 0; k < 8u; k++) {
+            h |= (uint8_t)(((plane_[(pos_ - k) & 7u][i >> 5] >> (i & 31u)) & 1u) << k);
+        }
+        return h;
+    }
+
+#if defined(BUTTON_DEBOUNCE_PROFILE)
+    // Cycles per bank tick (see ButtonDebounceProfile.h)
+    const ProfileStats& profile() const { return profile_; }
+    void resetProfile() { profile_.reset(); }
+#endif
+
+    // Reset every button to a known debounced state
+    void reset(bool start_down = false)
+    {
+        pos_ = 0u;
+        for (size_t w = 0; w < kWords; w++) {
+            const uint32_t lvl = start_down ? laneMask(w) : 0u;
+            for (unsigned k = 0; k < 8u; k++) plane_[k][w] = lvl;
+            down_[w] = lvl;
+            pressed_[w] = 0u;
+            released_[w] = 0u;
+        }
+    }
+
+private:
+    static uint32_t laneMask(size_t w)
+    {
+        const size_t lanes = N - w * 32u;
+        return (lanes >= 32u) ? 0xFFFFFFFFu : ((1u << lanes) - 1u);
+    }
+
+    void updateWords(const uint32_t* port, uint32_t flip)
+    {
+        BUTTON_DEBOUNCE_PROFILE_SCOPE(profile_);
+
+        pos_ = (uint8_t)((pos_ + 1u) & 7u);
+
+        for (size_t w = 0; w < kWords; w++) {
+            plane_[pos_][w] = (port[w] ^ flip) & laneMask(w);
+
+            // votes = sum of the newest window_ planes, lane by lane
+            SlicedCounter<4> votes;
+            for (unsigned k = 0; k < window_; k++) {
+                votes.increment(plane_[(pos_ - k) & 7u][w]);
+            }
+
+            pressed_[w]  = ~down_[w] & votes.atLeast(cfg_.maj_on);
+            released_[w] = down_[w] & ~votes.atLeast(cfg_.maj_off + 1u);
+            down_[w] = (down_[w] | pressed_[w]) & ~released_[w];
+        }
+    }
+
+    ButtonDebounce::Config cfg_;
+    uint8_t window_;
+    uint8_t pos_;   // plane holding the newest sample
+
+    uint32_t plane_[8][kWords];   // sample history, one plane per tick
+    uint32_t down_[kWords];
+    uint32_t pressed_[kWords];
+    uint32_t released_[kWords];
+
+#if defined(BUTTON_DEBOUNCE_PROFILE)
+    ProfileStats profile_;
+#endif
+};
@@ -0,0 +1,124 @@
+/**
+ * ButtonDebounce - Median Bank
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * The median engine for whole port words at once. Each lane keeps a
+ * bit-sliced running count of ones in its window: lanes where a 1 enters
+ * and none leaves count up, lanes where a 1 leaves and none enters count
+ * down. Cost per tick is independent of the window length.
+ *
+ * Usage:
+ *   MedianBank<64> keys;                    // uses med_n
+ *   uint32_t raw[MedianBank<64>::kWords] = { readPortA(), readPortB() };
+ *   keys.update(raw);
+ *   uint32_t hits = keys.pressedMask()[0];
+ *
+ * Notes:
+ *  - Header-only and independent of the engine .cpp in the build; it
+ *    produces the same events as buttonDebounceMedian.cpp.
+ *  - Per-button cost is 8 history bits plus a 3-bit count.
+ */
+
+#pragma once
+#include "ButtonDebounce.h"
+#include "ButtonDebounceBitSlice.h"
+#include "ButtonDebounceProfile.h"
+#include <stddef.h>
+
+template <size_t N>
+class MedianBank {
+public:
+    static const size_t kButtons = N;
+    static const size_t kWords   = (N + 31u) / 32u;
+
+    MedianBank() : MedianBank(ButtonDebounce::Config()) {}
+    explicit MedianBank(const ButtonDebounce::Config& cfg)
+    {
+        // Odd window 1..7, as the engine
+        n_ = cfg.med_n > 7u ? 7u : cfg.med_n;
+        if ((n_ & 1u) == 0u) n_ = n_ ? (uint8_t)(n_ - 1u) : 1u;
+        reset(false);
+    }
+
+    // Call each tick. raw_down[w] bit b = raw state of button (w*32 + b).
+    void update(const uint32_t* raw_down) { updateWords(raw_down, 0u); }
+
+    // Convenience for pull-up wiring (pressed when the port bit reads 0)
+    void updateActiveLow(const uint32_t* port) { updateWords(port, 0xFFFFFFFFu); }
+
+    // Masks from the last update() (bit i = button i)
+    const uint32_t* downMask()     const { return down_; }
+    const uint32_t* pressedMask()  const { return pressed_; }
+    const uint32_t* releasedMask() const { return released_; }
+
+    bool down(size_t i)     const { return ((down_[i >> 5]     >> (i & 31u)) & 1u) != 0u; }
+    bool pressed(size_t i)  const { return ((pressed_[i >> 5]  >> (i & 31u)) & 1u) != 0u; }
+    bool released(size_t i) const { return ((released_[i >> 5] >> (i & 31u)) & 1u) != 0u; }
+
+#if defined(BUTTON_DEBOUNCE_PROFILE)
+    // Cycles per bank tick (see ButtonDebounceProfile.h)
+    const ProfileStats& profile() const { return profile_; }
+    void resetProfile() { profile_.reset(); }
+#endif
+
+    // Reset every button to a known debounced state
+    void reset(bool start_down = false)
+    {
+        pos_ = 0u;
+        for (size_t w = 0; w < kWords; w++) {
+            const uint32_t lvl = start_down ? laneMask(w) : 0u;
+            for (unsigned k = 0; k < 8u; k++) plane_[k][w] = lvl;
+            ones_[w].clear(0xFFFFFFFFu);
+            for (unsigned k = 0; k < n_; k++) ones_[w].increment(lvl);
+            down_[w] = lvl;
+            pressed_[w] = 0u;
+            released_[w] = 0u;
+        }
+    }
+
+private:
+    static uint32_t laneMask(size_t w)
+    {
+        const size_t lanes = N - w * 32u;
+        return (lanes >= 32u) ? 0xFFFFFFFFu : ((1u << lanes) - 1u);
+    }
+
+    void updateWords(const uint32_t* port, uint32_t flip)
+    {
+        BUTTON_DEBOUNCE_PROFILE_SCOPE(profile_);
+
+        // Plane n_ - 1 back from the newest drops out of the window
+        const uint8_t out = (uint8_t)((pos_ - (n_ - 1u)) & 7u);
+        pos_ = (uint8_t)((pos_ + 1u) & 7u);
+
+        for (size_t w = 0; w < kWords; w++) {
+            const uint32_t in = (port[w] ^ flip) & laneMask(w);
+            const uint32_t leaving = plane_[out][w];
+            plane_[pos_][w] = in;
+
+            ones_[w].increment(in & ~leaving);
+            ones_[w].decrement(leaving & ~in);
+
+            const uint32_t level = ones_[w].atLeast((n_ >> 1) + 1u);
+            pressed_[w]  = level & ~down_[w];
+            released_[w] = down_[w] & ~level;
+            down_[w] = level;
+        }
+    }
+
+    uint8_t n_;     // window length (odd)
+    uint8_t pos_;   // plane holding the newest sample
+
+    uint32_t plane_[8][kWords];   // sample history, one plane per tick
+    SlicedCounter<3> ones_[kWords];
+    uint32_t down_[kWords];
+    uint32_t pressed_[kWords];
+    uint32_t released_[kWords];
+
+#if defined(BUTTON_DEBOUNCE_PROFILE)
+    ProfileStats profile_;
+#endif
+};
@@ -0,0 +1,158 @@
+/**
+ * ButtonDebounce - Pattern Bank
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * The pattern-mask engine for whole port words at once. History is kept
+ * as bit planes (one word per tick, one lane per button), so a rule is
+ * tested on 32 buttons by ANDing the planes of its care bits, each taken
+ * as-is (match 1) or inverted (match 0). Cost per word is one operation
+ * per care bit; don't-care bits are free.
+ *
+ * Usage:
+ *   ButtonDebounce::Config cfg;
+ *   cfg.pat_press   = ButtonDebounce::pattern("00xx1111");
+ *   cfg.pat_release = ButtonDebounce::pattern("11xx0000");
+ *   PatternBank<64> keys(cfg);
+ *   keys.update(raw);
+ *   uint32_t hits = keys.pressedMask()[0];
+ *
+ * Notes:
+ *  - Header-only and independent of the engine .cpp in the build; it
+ *    produces the same events as buttonDebouncePattern.cpp with the same
+ *    BUTTON_DEBOUNCE_PATTERN_BITS.
+ *  - Planes are kept for every history bit (8 to 64 words per 32 buttons).
+ */
+
+#pragma once
+#include "ButtonDebounce.h"
+#include "ButtonDebounceProfile.h"
+#include <stddef.h>
+
+template <size_t N>
+class PatternBank {
+public:
+    static const size_t kButtons = N;
+    static const size_t kWords   = (N + 31u) / 32u;
+    static const unsigned kBits  = 8u * sizeof(ButtonDebounce::PatternBits);
+
+    PatternBank() : PatternBank(ButtonDebounce::Config()) {}
+    explicit PatternBank(const ButtonDebounce::Config& cfg)
+    {
+        press_n_ = compile(cfg.pat_press, press_);
+        release_n_ = compile(cfg.pat_release, release_);
+        reset(false);
+    }
+
+    // Call each tick. raw_down[w] bit b = raw state of button (w*32 + b).
+    void update(const uint32_t* raw_down) { updateWords(raw_down, 0u); }
+
+    // Convenience for pull-up wiring (pressed when the port bit reads 0)
+    void updateActiveLow(const uint32_t* port) { updateWords(port, 0xFFFFFFFFu); }
+
+    // Masks from the last update() (bit i = button i)
+    const uint32_t* downMask()     const { return down_; }
+    const uint32_t* pressedMask()  const { return pressed_; }
+    const uint32_t* releasedMask() const { return released_; }
+
+    bool down(size_t i)     const { return ((down_[i >> 5]     >> (i & 31u)) & 1u) != 0u; }
+    bool pressed(size_t i)  const { return ((pressed_[i >> 5]  >> (i & 31u)) & 1u) != 0u; }
+    bool released(size_t i) const { return ((released_[i >> 5] >> (i & 31u)) & 1u) != 0u; }
+
+    // History byte of one button (LSB = newest), as ButtonDebounce::history()
+    uint8_t history(size_t i) const
+    {
+        uint8_t h = 0u;
+        for (unsigned k = 0; k < 8u; k++) {
+            h |= (uint8_t)(((plane_[(pos_ - k) & (kBits - 1u)][i >> 5] >> (i & 31u)) & 1u) << k);
+        }
+        return h;
+    }
+
+#if defined(BUTTON_DEBOUNCE_PROFILE)
+    // Cycles per bank tick (see ButtonDebounceProfile.h)
+    const ProfileStats& profile() const { return profile_; }
+    void resetProfile() { profile_.reset(); }
+#endif
+
+    // Reset every button to a known debounced state
+    void reset(bool start_down = false)
+    {
+        pos_ = 0u;
+        for (size_t w = 0; w < kWords; w++) {
+            const uint32_t lvl = start_down ? laneMask(w) : 0u;
+            for (unsigned k = 0; k < kBits; k++) plane_[k][w] = lvl;
+            down_[w] = lvl;
+            pressed_[w] = 0u;
+            released_[w] = 0u;
+        }
+    }
+
+private:
+    // One care bit of a rule: its age in ticks and the word that inverts
+    // the plane when the bit must read 0
+    struct Term {
+        uint8_t  age;
+        uint32_t flip;
+    };
+
+    static unsigned compile(const ButtonDebounce::Pattern& rule, Term* out)
+    {
+        unsigned n = 0u;
+        for (unsigned k = 0; k < kBits; k++) {
+            if (((rule.care >> k) & 1u) == 0u) continue;
+            out[n].age = (uint8_t)k;
+            out[n].flip = ((rule.match >> k) & 1u) ? 0u : 0xFFFFFFFFu;
+            n++;
+        }
+        return n;
+    }
+
+    static uint32_t laneMask(size_t w)
+    {
+        const size_t lanes = N - w * 32u;
+        return (lanes >= 32u) ? 0xFFFFFFFFu : ((1u << lanes) - 1u);
+    }
+
+    // Lanes of word w whose history satisfies every term
+    uint32_t matches(const Term* terms, unsigned n, size_t w) const
+    {
+        uint32_t m = 0xFFFFFFFFu;
+        for (unsigned t = 0; t < n; t++) {
+            m &= plane_[(pos_ - terms[t].age) & (kBits - 1u)][w] ^ terms[t].flip;
+        }
+        return m;
+    }
+
+    void updateWords(const uint32_t* port, uint32_t flip)
+    {
+        BUTTON_DEBOUNCE_PROFILE_SCOPE(profile_);
+
+        pos_ = (uint8_t)((pos_ + 1u) & (kBits - 1u));
+
+        for (size_t w = 0; w < kWords; w++) {
+            plane_[pos_][w] = (port[w] ^ flip) & laneMask(w);
+
+            pressed_[w]  = ~down_[w] & matches(press_, press_n_, w) & laneMask(w);
+            released_[w] = down_[w] & matches(release_, release_n_, w);
+            down_[w] = (down_[w] | pressed_[w]) & ~released_[w];
+        }
+    }
+
+    Term press_[kBits];
+    Term release_[kBits];
+    unsigned press_n_;
+    unsigned release_n_;
+    uint8_t pos_;   // plane holding the newest sample
+
+    uint32_t plane_[kBits][kWords];   // sample history, one plane per tick
+    uint32_t down_[kWords];
+    uint32_t pressed_[kWords];
+    uint32_t released_[kWords];
+
+#if defined(BUTTON_DEBOUNCE_PROFILE)
+    ProfileStats profile_;
+#endif
+};
@@ -0,0 +1,117 @@
+/**
+ * ButtonDebounce - Hot-Path Profiling Hooks
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * Optional cycle accounting around ButtonDebounce::update() and the bank
+ * updates, for checking worst-case scan ISR time. Compiled out entirely
+ * unless a cycle source is selected.
+ *
+ * Cycle source (define exactly one, project-wide):
+ *   BUTTON_DEBOUNCE_PROFILE_RDTSC    x86 time-stamp counter
+ *   BUTTON_DEBOUNCE_PROFILE_DWT      Cortex-M DWT->CYCCNT (the application
+ *                                    must enable TRCENA and CYCCNTENA)
+ *   BUTTON_DEBOUNCE_PROFILE_CUSTOM   application provides
+ *                                    uint32_t buttonDebounceCycles()
+ *
+ * Usage:
+ *   -DBUTTON_DEBOUNCE_PROFILE_DWT
+ *
+ *   const ProfileStats& s = ButtonDebounce::profile();   // engine update()
+ *   const ProfileStats& b = bank.profile();               // whole-bank tick
+ *   printf("max %lu cycles\n", (unsigned long)s.max);
+ *
+ * Notes:
+ *  - Stats accumulate min/max/total cycles per call, including the
+ *    counter reads themselves (a few cycles; measure an empty scope to
+ *    calibrate).
+ *  - The engine stats are shared by every ButtonDebounce instance;
+ *    a build links exactly one engine, so they are per-engine stats.
+ */
+
+#pragma once
+#include <stdint.h>
+
+#if defined(BUTTON_DEBOUNCE_PROFILE_RDTSC) || defined(BUTTON_DEBOUNCE_PROFILE_DWT) || \
+    defined(BUTTON_DEBOUNCE_PROFILE_CUSTOM)
+#define BUTTON_DEBOUNCE_PROFILE 1
+#endif
+
+#if defined(BUTTON_DEBOUNCE_PROFILE_RDTSC)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#elif defined(BUTTON_DEBOUNCE_PROFILE_CUSTOM)
+uint32_t buttonDebounceCycles();
+#endif
+
+struct ProfileStats {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+
+    constexpr ProfileStats() : count(0u), min(0xFFFFFFFFu), max(0u), total(0u) {}
+
+    void add(uint32_t cycles)
+    {
+        count++;
+        total += cycles;
+        if (cycles < min) min = cycles;
+        if (cycles > max) max = cycles;
+    }
+
+    uint32_t mean() const { return count ? (uint32_t)(total / count) : 0u; }
+
+    void reset() { *this = ProfileStats(); }
+};
+
+#if defined(BUTTON_DEBOUNCE_PROFILE)
+
+// Free-running 32-bit cycle counter; differences wrap correctly
+static inline uint32_t buttonDebounceReadCycles()
+{
+#if defined(BUTTON_DEBOUNCE_PROFILE_RDTSC)
+    return (uint32_t)__rdtsc();
+#elif defined(BUTTON_DEBOUNCE_PROFILE_DWT)
+    return *(volatile uint32_t*)0xE0001004u;   // DWT->CYCCNT
+#else
+    return buttonDebounceCycles();
+#endif
+}
+
+// Adds the cycles spent in its scope to a ProfileStats on exit
+class ProfileScope {
+public:
+    explicit ProfileScope(ProfileStats& stats) : stats_(stats), t0_(buttonDebounceReadCycles()) {}
+    ~ProfileScope() { stats_.add(buttonDebounceReadCycles() - t0_); }
+
+private:
+    ProfileScope(const ProfileScope&);
+    ProfileScope& operator=(const ProfileScope&);
+
+    ProfileStats& stats_;
+    uint32_t      t0_;
+};
+
+// Static storage usable from headers without a .cpp (and without a
+// function-local static guard in the ISR path)
+template <class Tag>
+struct ProfileSlot {
+    static ProfileStats stats;
+};
+
+template <class Tag>
+ProfileStats ProfileSlot<Tag>::stats;
+
+#define BUTTON_DEBOUNCE_PROFILE_SCOPE(stats) ProfileScope button_debounce_profile_scope_(stats)
+
+#else
+
+#define BUTTON_DEBOUNCE_PROFILE_SCOPE(stats) do {} while (0)
+
+#endif
@@ -0,0 +1,217 @@
+/**
+ * ButtonDebounce - SPDT (Changeover) Inputs
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * Debouncing for switches with both the normally-open (NO) and the
+ * normally-closed (NC) contact wired. The pair is treated as an SR latch:
+ * the moving contact only bounces against the throw it just reached, and
+ * while it bounces it never touches the other one, so the first closure
+ * of the other throw is already a clean edge. No filtering, no delay.
+ *
+ * SpdtDebounce:
+ * - NO closed, NC open  -> set   (down, pressed() on the same tick)
+ * - NC closed, NO open  -> reset (up, released() on the same tick)
+ * - Both open           -> hold (contact in transit or bouncing)
+ * - Both closed         -> hold; a fault once it lasts fault_ticks ticks
+ *   (shorted contacts or wiring; impossible for a healthy switch)
+ *
+ * SpdtBank<N>:
+ * - The same latch for N switches from two port words per 32 switches
+ *   (one for the NO contacts, one for the NC contacts), bit-parallel
+ *
+ * Usage:
+ *   SpdtDebounce sw;
+ *   sw.updateActiveLow(digitalRead(NO_PIN), digitalRead(NC_PIN));
+ *   if (sw.pressed()) { ... }
+ *   if (sw.faultRaised()) { ... }       // both contacts stuck closed
+ *
+ *   SpdtBank<32> panel;
+ *   uint32_t no = readPortA(), nc = readPortB();
+ *   panel.updateActiveLow(&no, &nc);
+ *
+ * Notes:
+ *  - Same pressed()/released()/down()/up() contract as ButtonDebounce.
+ *  - fault_ticks = 0 disables fault detection. The level is held through
+ *    a fault and follows the contacts again as soon as one reads open.
+ */
+
+#pragma once
+#include "ButtonDebounceBitSlice.h"
+#include "ButtonDebounceProfile.h"
+#include <stdint.h>
+#include <stddef.h>
+
+class SpdtDebounce {
+public:
+    struct Config {
+        uint8_t fault_ticks = 4;   // both contacts closed this long = fault (~20ms @ 5ms)
+    };
+
+    SpdtDebounce() : SpdtDebounce(Config()) {}
+    explicit SpdtDebounce(const Config& cfg) : cfg_(cfg) { reset(false); }
+
+    // Call each tick with both contact states (true = contact closed)
+    void update(bool no_closed, bool nc_closed)
+    {
+        pressed_ = false;
+        released_ = false;
+        fault_raised_ = false;
+
+        // Both closed: hold the level and time the fault
+        if (no_closed && nc_closed) {
+            if (both_ < 255u) both_++;
+            if (cfg_.fault_ticks != 0u && both_ >= cfg_.fault_ticks && !fault_) {
+                fault_ = true;
+                fault_raised_ = true;
+            }
+            return;
+        }
+        both_ = 0u;
+        fault_ = false;
+
+        // SR latch: a closed throw sets the level, both open holds it
+        if (no_closed && !state_) {
+            state_ = true;
+            pressed_ = true;
+        } else if (nc_closed && state_) {
+            state_ = false;
+            released_ = true;
+        }
+    }
+
+    // Convenience for pull-up wiring (contact closed when the pin reads 0)
+    void updateActiveLow(bool no_pin_high, bool nc_pin_high) { update(!no_pin_high, !nc_pin_high); }
+
+    // One-shot events
+    bool pressed()  const { return pressed_; }
+    bool released() const { return released_; }
+
+    // Debounced level
+    bool down() const { return state_; }
+    bool up()   const { return !state_; }
+
+    // Both contacts closed for fault_ticks or more (level is held)
+    bool fault() const { return fault_; }
+
+    // One-shot: the fault was detected this tick
+    bool faultRaised() const { return fault_raised_; }
+
+    // Reset to known debounced state
+    void reset(bool start_down = false)
+    {
+        state_ = start_down;
+        pressed_ = false;
+        released_ = false;
+        fault_ = false;
+        fault_raised_ = false;
+        both_ = 0u;
+    }
+
+private:
+    Config  cfg_;
+    uint8_t both_         = 0;   // consecutive ticks with both contacts closed
+    bool    state_        = false;
+    bool    pressed_      = false;
+    bool    released_     = false;
+    bool    fault_        = false;
+    bool    fault_raised_ = false;
+};
+
+template <size_t N>
+class SpdtBank {
+public:
+    static const size_t kButtons = N;
+    static const size_t kWords   = (N + 31u) / 32u;
+
+    SpdtBank() : SpdtBank(SpdtDebounce::Config()) {}
+    explicit SpdtBank(const SpdtDebounce::Config& cfg) : cfg_(cfg) { reset(false); }
+
+    // Call each tick. no[w] / nc[w] bit b = NO / NC contact of switch
+    // (w*32 + b) closed.
+    void update(const uint32_t* no, const uint32_t* nc) { updateWords(no, nc, 0u); }
+
+    // Convenience for pull-up wiring (contact closed when the port bit reads 0)
+    void updateActiveLow(const uint32_t* no_port, const uint32_t* nc_port)
+    {
+        updateWords(no_port, nc_port, 0xFFFFFFFFu);
+    }
+
+    // Masks from the last update() (bit i = switch i)
+    const uint32_t* downMask()        const { return down_; }
+    const uint32_t* pressedMask()     const { return pressed_; }
+    const uint32_t* releasedMask()    const { return released_; }
+    const uint32_t* faultMask()       const { return fault_; }
+    const uint32_t* faultRaisedMask() const { return fault_raised_; }
+
+    bool down(size_t i)     const { return ((down_[i >> 5]     >> (i & 31u)) & 1u) != 0u; }
+    bool pressed(size_t i)  const { return ((pressed_[i >> 5]  >> (i & 31u)) & 1u) != 0u; }
+    bool released(size_t i) const { return ((released_[i >> 5] >> (i & 31u)) & 1u) != 0u; }
+    bool fault(size_t i)    const { return ((fault_[i >> 5]    >> (i & 31u)) & 1u) != 0u; }
+
+#if defined(BUTTON_DEBOUNCE_PROFILE)
+    // Cycles per bank tick (see ButtonDebounceProfile.h)
+    const ProfileStats& profile() const { return profile_; }
+    void resetProfile() { profile_.reset(); }
+#endif
+
+    // Reset every switch to a known debounced state
+    void reset(bool start_down = false)
+    {
+        for (size_t w = 0; w < kWords; w++) {
+            down_[w] = start_down ? laneMask(w) : 0u;
+            pressed_[w] = 0u;
+            released_[w] = 0u;
+            fault_[w] = 0u;
+            fault_raised_[w] = 0u;
+            both_[w].clear(0xFFFFFFFFu);
+        }
+    }
+
+private:
+    static uint32_t laneMask(size_t w)
+    {
+        const size_t lanes = N - w * 32u;
+        return (lanes >= 32u) ? 0xFFFFFFFFu : ((1u << lanes) - 1u);
+    }
+
+    void updateWords(const uint32_t* no_port, const uint32_t* nc_port, uint32_t flip)
+    {
+        BUTTON_DEBOUNCE_PROFILE_SCOPE(profile_);
+
+        for (size_t w = 0; w < kWords; w++) {
+            const uint32_t lanes = laneMask(w);
+            const uint32_t no = (no_port[w] ^ flip) & lanes;
+            const uint32_t nc = (nc_port[w] ^ flip) & lanes;
+            const uint32_t both = no & nc;
+
+            // Fault timer on lanes with both contacts closed
+            both_[w].clear(~both);
+            both_[w].increment(both);
+            const uint32_t fault = cfg_.fault_ticks ? (both_[w].atLeast(cfg_.fault_ticks) & lanes) : 0u;
+            fault_raised_[w] = fault & ~fault_[w];
+            fault_[w] = fault;
+
+            // SR latch: set on NO only, reset on NC only, hold otherwise
+            const uint32_t next = (down_[w] | (no & ~nc)) & ~(nc & ~no);
+            pressed_[w]  = next & ~down_[w];
+            released_[w] = down_[w] & ~next;
+            down_[w] = next;
+        }
+    }
+
+    SpdtDebounce::Config cfg_;
+
+    SlicedCounter<8> both_[kWords];   // consecutive both-closed ticks, per lane
+    uint32_t down_[kWords];
+    uint32_t pressed_[kWords];
+    uint32_t released_[kWords];
+    uint32_t fault_[kWords];
+    uint32_t fault_raised_[kWords];
+
+#if defined(BUTTON_DEBOUNCE_PROFILE)
+    ProfileStats profile_;
+#endif
+};
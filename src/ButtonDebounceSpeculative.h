@@ -0,0 +1,165 @@
+/**
+ * ButtonDebounce - Speculative Press Layer
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * First-edge reaction for latency-critical inputs, on top of any engine.
+ * The first raw press edge is reported at once as a TentativePress; the
+ * application starts its work optimistically, then commits on Confirm
+ * (the engine accepted the press) or rolls back on Cancel (it did not).
+ *
+ * Usage:
+ *   SpeculativePress spec;
+ *
+ *   btn.update(raw);
+ *   switch (spec.update(raw, btn)) {
+ *       case SpeculativePress::TentativePress: startShot();  break;
+ *       case SpeculativePress::Confirm:        commitShot(); break;
+ *       case SpeculativePress::Cancel:         abortShot();  break;
+ *       default: break;
+ *   }
+ *
+ * Rules:
+ *  - TentativePress: raw press edge while the debounced level is up and
+ *    nothing is pending.
+ *  - Confirm: the engine's level goes down while a press is pending. A
+ *    press with nothing pending (the engine accepted it on the first
+ *    edge, e.g. eager_press or consec_n = 1) is a Confirm on its own.
+ *  - Cancel: the engine comes to rest with the level still up (up() and
+ *    not debouncing()), or cancel_ticks pass without a Confirm (0 = wait
+ *    for the engine only). Pending latched events do not hold it off.
+ *
+ * Notes:
+ *  - Call once per tick, after the button's update(), with the same raw
+ *    sample. Works with one-shot and latched events (uses down()).
+ *  - stats() counts outcomes; cancelPermille() is the share of tentative
+ *    presses that were rolled back, meanConfirmTicks() the average time
+ *    the application ran on speculation before a Confirm. A high cancel
+ *    rate means the line glitches often enough that speculation costs
+ *    more than it saves; a long confirm time means the engine is slower
+ *    than it needs to be.
+ */
+
+#pragma once
+#include "ButtonDebounce.h"
+
+class SpeculativePress {
+public:
+    enum Event : uint8_t {
+        None = 0,
+        TentativePress,
+        Confirm,
+        Cancel
+    };
+
+    struct Config {
+        uint8_t cancel_ticks = 0;   // give up after this many ticks (0 = when the engine comes to rest)
+    };
+
+    struct Stats {
+        uint32_t tentative;       // speculative presses (including immediate Confirms)
+        uint32_t confirmed;       // ...that the engine accepted
+        uint32_t cancelled;       // ...that were rolled back
+        uint32_t confirm_ticks;   // total ticks from TentativePress to Confirm
+        uint16_t max_confirm_ticks;
+    };
+
+    SpeculativePress() : SpeculativePress(Config()) {}
+    explicit SpeculativePress(const Config& cfg) : cfg_(cfg)
+    {
+        reset(false);
+        resetStats();
+    }
+
+    // Call each tick after the button has been updated with raw_down
+    Event update(bool raw_down, const ButtonDebounce& btn)
+    {
+        const bool edge = raw_down && !prev_raw_;
+        const bool rose = btn.down() && !was_down_;
+        prev_raw_ = raw_down;
+        was_down_ = btn.down();
+
+        if (pending_) {
+            if (wait_ != 0xFFFFu) wait_++;
+
+            if (rose) {
+                pending_ = false;
+                noteConfirm(wait_);
+                return Confirm;
+            }
+            if ((btn.up() && !btn.debouncing()) ||
+                (cfg_.cancel_ticks != 0u && wait_ >= cfg_.cancel_ticks)) {
+                pending_ = false;
+                stats_.cancelled++;
+                return Cancel;
+            }
+            return None;
+        }
+
+        if (rose) {
+            // Accepted on the first edge: nothing to speculate on
+            stats_.tentative++;
+            noteConfirm(0u);
+            return Confirm;
+        }
+        if (edge && btn.up()) {
+            pending_ = true;
+            wait_ = 0u;
+            stats_.tentative++;
+            return TentativePress;
+        }
+        return None;
+    }
+
+    // A TentativePress is waiting for Confirm or Cancel
+    bool pending() const { return pending_; }
+
+    const Stats& stats() const { return stats_; }
+
+    // Share of speculative presses that were cancelled, in 1/1000
+    uint16_t cancelPermille() const
+    {
+        return stats_.tentative ? (uint16_t)((uint64_t)stats_.cancelled * 1000u / stats_.tentative) : 0u;
+    }
+
+    // Average ticks from TentativePress to Confirm
+    uint16_t meanConfirmTicks() const
+    {
+        return stats_.confirmed ? (uint16_t)(stats_.confirm_ticks / stats_.confirmed) : 0u;
+    }
+
+    void resetStats()
+    {
+        stats_.tentative = 0u;
+        stats_.confirmed = 0u;
+        stats_.cancelled = 0u;
+        stats_.confirm_ticks = 0u;
+        stats_.max_confirm_ticks = 0u;
+    }
+
+    // Match the button's reset(); drops a pending press without an event
+    void reset(bool start_down = false)
+    {
+        pending_ = false;
+        prev_raw_ = start_down;
+        was_down_ = start_down;
+        wait_ = 0u;
+    }
+
+private:
+    void noteConfirm(uint16_t ticks)
+    {
+        stats_.confirmed++;
+        stats_.confirm_ticks += ticks;
+        if (ticks > stats_.max_confirm_ticks) stats_.max_confirm_ticks = ticks;
+    }
+
+    Config   cfg_;
+    Stats    stats_;
+    uint16_t wait_;       // ticks since the TentativePress
+    bool     pending_;
+    bool     prev_raw_;   // last raw sample (edge detection)
+    bool     was_down_;   // debounced level after the last tick
+};
@@ -16,4 +16,4 @@
 // Semantic version as single integer for comparison
 #define BUTTON_DEBOUNCE_VERSION ((BUTTON_DEBOUNCE_VERSION_MAJOR * 10000) + \
                                  (BUTTON_DEBOUNCE_VERSION_MINOR * 100) + \
-                                 BUTTON_DEBOUNCE_VERSION_PATCH)
\ No newline at end of file
+                                 BUTTON_DEBOUNCE_VERSION_PATCH)
@@ -0,0 +1,103 @@
+/**
+ * ButtonDebounce - Adaptive Engine Implementation
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * Learns each switch's bounce time and sizes its acceptance window to it.
+ * Clean switches get minimal latency, worn switches still debounce.
+ *
+ * Algorithm:
+ * - Tracks raw edges in an 8-bit history (same as edge-gated)
+ * - Edges closer together than adapt_max ticks form one bounce burst
+ * - Accepts a new level after `window` identical samples
+ * - On each accepted change, measures the burst (first to last edge)
+ *   and sets window = burst + 1, clamped to [adapt_min, adapt_max]
+ * - Window grows immediately, shrinks by one tick per clean change
+ *
+ * Memory usage: 4 bytes (history + window + counters)
+ * Debounce time: adapt_min..adapt_max * tick_interval, per button
+ */
+
+#include "ButtonDebounce.h"
+
+#if !defined(BUTTON_DEBOUNCE_HEADER_ONLY) || defined(BUTTON_DEBOUNCE_ENGINE_BODY)
+
+BUTTON_DEBOUNCE_INLINE ButtonDebounce::ButtonDebounce(const Config& cfg) : cfg_(cfg)
+{
+    reset(false);
+}
+
+BUTTON_DEBOUNCE_INLINE void ButtonDebounce::reset(bool start_down)
+{
+    state_ = start_down;
+    clearEvents();
+
+    eng_.adaptive.hist = state_ ? 0xFFu : 0x00u;
+    eng_.adaptive.window = cfg_.adapt_min;
+    eng_.adaptive.run = 255u;
+    eng_.adaptive.span = 255u;
+}
+
+BUTTON_DEBOUNCE_INLINE void ButtonDebounce::update(bool raw_down)
+{
+    BUTTON_DEBOUNCE_PROFILE_SCOPE(profile());
+    beginTick();
+
+    AdaptiveState& a = eng_.adaptive;
+    update_hist(&a.hist, raw_down);
+
+    // Edge = newest sample differs from the previous one
+    const bool edge = ((a.hist ^ (a.hist >> 1)) & 1u) != 0u;
+
+    if (a.span < 255u) a.span++;
+    if (edge) {
+        if (a.run >= cfg_.adapt_max) a.span = 0u;   // quiet long enough: new burst
+        a.run = 0u;
+    } else if (a.run < 255u) {
+        a.run++;
+    }
+
+    // Require `window` identical samples (run counts ticks since the edge)
+    const bool level = (a.hist & 1u) != 0u;
+    if (level == state_ || (uint16_t)(a.run + 1u) < a.window) return;
+
+    if (level) {
+        notePressed();
+    } else {
+        noteReleased();
+    }
+
+    // Learn: window must outlast the longest quiet gap inside a burst,
+    // which is bounded by the burst's first-to-last edge duration.
+    uint16_t target = (uint16_t)(a.span - a.run) + 1u;
+    if (target < cfg_.adapt_min) target = cfg_.adapt_min;
+    if (target > cfg_.adapt_max) target = cfg_.adapt_max;
+
+    if (target > a.window) {
+        a.window = (uint8_t)target;
+    } else if (target < a.window) {
+        a.window--;
+    }
+}
+
+BUTTON_DEBOUNCE_INLINE uint8_t ButtonDebounce::history() const
+{
+    return eng_.adaptive.hist;
+}
+
+BUTTON_DEBOUNCE_INLINE bool ButtonDebounce::engineSettled() const
+{
+    // Full history agrees with the debounced level and the burst is over:
+    // the next edge starts a new burst whatever run/span have reached
+    return eng_.adaptive.run >= cfg_.adapt_max &&
+           eng_.adaptive.hist == (state_ ? 0xFFu : 0x00u);
+}
+
+BUTTON_DEBOUNCE_INLINE uint8_t ButtonDebounce::engineId()
+{
+    return kEngineAdaptive;
+}
+
+#endif
@@ -12,69 +12,114 @@
  * - Maintains 8-bit shift register of recent samples
  * - Changes state only when N consecutive bits match target
  * - Configurable N value (typically 2-4 samples)
+ * - Press and release may use different N (press_n / release_n)
+ * - Eager mode changes state on the first raw edge, then ignores the
+ *   line for lockout_ticks so chatter cannot produce extra events
+ * - BUTTON_DEBOUNCE_CONSTANT_TIME selects a branch-free update()
  * 
- * Memory usage: 3 bytes (history + counters)
+ * Memory usage: 4 bytes (history + counters)
  * Debounce time: consec_n * tick_interval
  */
 
 #include "ButtonDebounce.h"
 
-/**
- * Update history shift register with new sample.
- * @param h Pointer to 8-bit history register
- * @param raw_down Current raw button state
- */
+#if !defined(BUTTON_DEBOUNCE_HEADER_ONLY) || defined(BUTTON_DEBOUNCE_ENGINE_BODY)
 
-static void update_hist(uint8_t* h, bool raw_down)
-{
-    *h = (uint8_t)((*h << 1) | (raw_down ? 1u : 0u));
-}
-
-ButtonDebounce::ButtonDebounce(const Config& cfg) : cfg_(cfg)
+BUTTON_DEBOUNCE_INLINE ButtonDebounce::ButtonDebounce(const Config& cfg) : cfg_(cfg)
 {
     reset(false);
 }
 
-void ButtonDebounce::reset(bool start_down)
+BUTTON_DEBOUNCE_INLINE void ButtonDebounce::reset(bool start_down)
 {
     state_ = start_down;
-    pressed_ = false;
-    released_ = false;
+    clearEvents();
 
     eng_.history.hist = state_ ? 0xFFu : 0x00u;
     eng_.history.unstable = 0u;
     eng_.history.bounce_k = 0u;
+    eng_.history.lockout = 0u;
+}
+
+#if defined(BUTTON_DEBOUNCE_CONSTANT_TIME)
+
+// Constant-time variant: same behaviour, conditional-select arithmetic only
+BUTTON_DEBOUNCE_INLINE void ButtonDebounce::update(bool raw_down)
+{
+    BUTTON_DEBOUNCE_PROFILE_SCOPE(profile());
+    beginTick();
+
+    HistoryState& h = eng_.history;
+    update_hist(&h.hist, raw_down);
+
+    // Eager hold-off: count down, accept nothing while it runs
+    const uint8_t live = (uint8_t)(h.lockout == 0u);
+    h.lockout = (uint8_t)(h.lockout - (live ^ 1u));
+
+    const uint8_t pmask = cfg_.eager_press   ? 0x01u : run_mask(cfg_.press_n, cfg_.consec_n);
+    const uint8_t rmask = cfg_.eager_release ? 0x01u : run_mask(cfg_.release_n, cfg_.consec_n);
+
+    const uint8_t st = (uint8_t)state_;
+    const uint8_t pr = (uint8_t)(live & (st ^ 1u) & (uint8_t)((h.hist & pmask) == pmask));
+    const uint8_t rl = (uint8_t)(live & st & (uint8_t)((h.hist & rmask) == 0u));
+    noteEvents(pr, rl);
+
+    const uint8_t eager = (uint8_t)((pr & (uint8_t)cfg_.eager_press) | (rl & (uint8_t)cfg_.eager_release));
+    h.lockout = (uint8_t)(h.lockout | (cfg_.lockout_ticks & (uint8_t)(0u - eager)));
 }
 
-void ButtonDebounce::update(bool raw_down)
+#else
+
+BUTTON_DEBOUNCE_INLINE void ButtonDebounce::update(bool raw_down)
 {
-    pressed_ = false;
-    released_ = false;
+    BUTTON_DEBOUNCE_PROFILE_SCOPE(profile());
+    beginTick();
 
     update_hist(&eng_.history.hist, raw_down);
 
+    // Eager hold-off: line is ignored until the lockout expires
+    if (eng_.history.lockout) {
+        eng_.history.lockout--;
+        return;
+    }
+
     // Require N consecutive stable samples at the LSB end
-    const uint8_t n = cfg_.consec_n;
-    const uint8_t mask = (n >= 8u) ? 0xFFu : (uint8_t)((1u << n) - 1u);
+    // (eager: a single sample, followed by the lockout)
+    const uint8_t pmask = cfg_.eager_press   ? 0x01u : run_mask(cfg_.press_n, cfg_.consec_n);
+    const uint8_t rmask = cfg_.eager_release ? 0x01u : run_mask(cfg_.release_n, cfg_.consec_n);
 
-    const bool all_pressed  = ((eng_.history.hist & mask) == mask);
-    const bool all_released = ((eng_.history.hist & mask) == 0u);
+    const bool all_pressed  = ((eng_.history.hist & pmask) == pmask);
+    const bool all_released = ((eng_.history.hist & rmask) == 0u);
 
     if (!state_ && all_pressed) {
-        state_ = true;
-        pressed_ = true;
+        notePressed();
+        if (cfg_.eager_press) eng_.history.lockout = cfg_.lockout_ticks;
     } else if (state_ && all_released) {
-        state_ = false;
-        released_ = true;
+        noteReleased();
+        if (cfg_.eager_release) eng_.history.lockout = cfg_.lockout_ticks;
     }
 
-    // Optional alternate (your "00xxx111 / 11xxx000" idea):
-    // const uint8_t M = 0b11000111u;
-    // if (!state_ && ((eng_.history.hist & M) == 0b00000111u)) { state_=true; pressed_=true; }
-    // if ( state_ && ((eng_.history.hist & M) == 0b11000000u)) { state_=false; released_=true; }
+    // The "00xxx111 / 11xxx000" alternate rule is the Pattern engine
+    // (buttonDebouncePattern.cpp), with any care/match masks
 }
 
-uint8_t ButtonDebounce::history() const
+#endif
+
+BUTTON_DEBOUNCE_INLINE uint8_t ButtonDebounce::history() const
 {
     return eng_.history.hist;
-}
\ No newline at end of file
+}
+
+BUTTON_DEBOUNCE_INLINE bool ButtonDebounce::engineSettled() const
+{
+    // Full history agrees with the debounced level, no hold-off running
+    return eng_.history.lockout == 0u &&
+           eng_.history.hist == (state_ ? 0xFFu : 0x00u);
+}
+
+BUTTON_DEBOUNCE_INLINE uint8_t ButtonDebounce::engineId()
+{
+    return kEngineConsecutive;
+}
+
+#endif
@@ -13,47 +13,91 @@
  * - Gates state changes during detected bounce periods
  * - Timeout mechanism prevents permanent lockup
  * - Falls back to consecutive logic when stable
+ *   (including asymmetric press_n / release_n and eager lock-out)
+ * - BUTTON_DEBOUNCE_CONSTANT_TIME selects a branch-free update()
  * 
- * Memory usage: 3 bytes (history + bounce counters)
+ * Memory usage: 4 bytes (history + bounce counters)
  * Debounce time: Adaptive based on chatter detection
  */
 
 #include "ButtonDebounce.h"
 
-/**
- * Update history shift register with new sample.
- * @param h Pointer to 8-bit history register
- * @param raw_down Current raw button state
- */
+#if !defined(BUTTON_DEBOUNCE_HEADER_ONLY) || defined(BUTTON_DEBOUNCE_ENGINE_BODY)
 
-static void update_hist(uint8_t* h, bool raw_down)
-{
-    *h = (uint8_t)((*h << 1) | (raw_down ? 1u : 0u));
-}
-
-ButtonDebounce::ButtonDebounce(const Config& cfg) : cfg_(cfg)
+BUTTON_DEBOUNCE_INLINE ButtonDebounce::ButtonDebounce(const Config& cfg) : cfg_(cfg)
 {
     reset(false);
 }
 
-void ButtonDebounce::reset(bool start_down)
+BUTTON_DEBOUNCE_INLINE void ButtonDebounce::reset(bool start_down)
 {
     state_ = start_down;
-    pressed_ = false;
-    released_ = false;
+    clearEvents();
 
     eng_.history.hist = state_ ? 0xFFu : 0x00u;
     eng_.history.unstable = 0u;
     eng_.history.bounce_k = 0u;
+    eng_.history.lockout = 0u;
+}
+
+#if defined(BUTTON_DEBOUNCE_CONSTANT_TIME)
+
+// Constant-time variant: same behaviour, conditional-select arithmetic only.
+// Every step is evaluated every tick; lockout and timeout select which
+// results are kept instead of returning early.
+BUTTON_DEBOUNCE_INLINE void ButtonDebounce::update(bool raw_down)
+{
+    BUTTON_DEBOUNCE_PROFILE_SCOPE(profile());
+    beginTick();
+
+    HistoryState& h = eng_.history;
+    update_hist(&h.hist, raw_down);
+
+    // Eager hold-off: count down, leave everything else untouched
+    const uint8_t live = (uint8_t)(h.lockout == 0u);
+    h.lockout = (uint8_t)(h.lockout - (live ^ 1u));
+
+    // Chatter detection and bounce confirmation (saturating counters)
+    const uint8_t bouncing_now = (uint8_t)(edgeCount8(h.hist) >= cfg_.edge_threshold);
+    const uint8_t bk = select8(bouncing_now, (uint8_t)(h.bounce_k + (uint8_t)(h.bounce_k < 255u)), 0u);
+    const uint8_t bouncing = (uint8_t)(bk >= cfg_.bounce_confirm);
+    const uint8_t us = select8(bouncing, (uint8_t)(h.unstable + (uint8_t)(h.unstable < 255u)), 0u);
+    const uint8_t timeout = (uint8_t)(us >= cfg_.unstable_timeout);
+
+    // Timeout -> recenter to current debounced state (prevents lock-up)
+    h.bounce_k = select8(live, select8(timeout, 0u, bk), h.bounce_k);
+    h.unstable = select8(live, select8(timeout, 0u, us), h.unstable);
+    h.hist     = select8((uint8_t)(live & timeout), (uint8_t)(0u - (uint8_t)state_), h.hist);
+
+    // Only accept changes when not bouncing (consecutive acceptance rule)
+    const uint8_t accept = (uint8_t)(live & (timeout ^ 1u) & (bouncing ^ 1u));
+    const uint8_t pmask = cfg_.eager_press   ? 0x01u : run_mask(cfg_.press_n, cfg_.consec_n);
+    const uint8_t rmask = cfg_.eager_release ? 0x01u : run_mask(cfg_.release_n, cfg_.consec_n);
+
+    const uint8_t st = (uint8_t)state_;
+    const uint8_t pr = (uint8_t)(accept & (st ^ 1u) & (uint8_t)((h.hist & pmask) == pmask));
+    const uint8_t rl = (uint8_t)(accept & st & (uint8_t)((h.hist & rmask) == 0u));
+    noteEvents(pr, rl);
+
+    const uint8_t eager = (uint8_t)((pr & (uint8_t)cfg_.eager_press) | (rl & (uint8_t)cfg_.eager_release));
+    h.lockout = (uint8_t)(h.lockout | (cfg_.lockout_ticks & (uint8_t)(0u - eager)));
 }
 
-void ButtonDebounce::update(bool raw_down)
+#else
+
+BUTTON_DEBOUNCE_INLINE void ButtonDebounce::update(bool raw_down)
 {
-    pressed_ = false;
-    released_ = false;
+    BUTTON_DEBOUNCE_PROFILE_SCOPE(profile());
+    beginTick();
 
     update_hist(&eng_.history.hist, raw_down);
 
+    // Eager hold-off: line is ignored until the lockout expires
+    if (eng_.history.lockout) {
+        eng_.history.lockout--;
+        return;
+    }
+
     // Detect chatter via edge count across the 8-sample window
     const uint8_t edges = edgeCount8(eng_.history.hist);
     const bool bouncing_now = (edges >= cfg_.edge_threshold);
@@ -84,23 +128,41 @@ void ButtonDebounce::update(bool raw_down)
 
     // Only accept changes when not bouncing (reuse consecutive acceptance rule)
     if (!bouncing) {
-        const uint8_t n = cfg_.consec_n;
-        const uint8_t mask = (n >= 8u) ? 0xFFu : (uint8_t)((1u << n) - 1u);
+        const uint8_t pmask = cfg_.eager_press   ? 0x01u : run_mask(cfg_.press_n, cfg_.consec_n);
+        const uint8_t rmask = cfg_.eager_release ? 0x01u : run_mask(cfg_.release_n, cfg_.consec_n);
 
-        const bool all_pressed  = ((eng_.history.hist & mask) == mask);
-        const bool all_released = ((eng_.history.hist & mask) == 0u);
+        const bool all_pressed  = ((eng_.history.hist & pmask) == pmask);
+        const bool all_released = ((eng_.history.hist & rmask) == 0u);
 
         if (!state_ && all_pressed) {
-            state_ = true;
-            pressed_ = true;
+            notePressed();
+            if (cfg_.eager_press) eng_.history.lockout = cfg_.lockout_ticks;
         } else if (state_ && all_released) {
-            state_ = false;
-            released_ = true;
+            noteReleased();
+            if (cfg_.eager_release) eng_.history.lockout = cfg_.lockout_ticks;
         }
     }
 }
 
-uint8_t ButtonDebounce::history() const
+#endif
+
+BUTTON_DEBOUNCE_INLINE uint8_t ButtonDebounce::history() const
 {
     return eng_.history.hist;
 }
+
+BUTTON_DEBOUNCE_INLINE bool ButtonDebounce::engineSettled() const
+{
+    // Full history agrees with the debounced level, no hold-off running,
+    // chatter counters cleared
+    const HistoryState& h = eng_.history;
+    return h.lockout == 0u && h.bounce_k == 0u && h.unstable == 0u &&
+           h.hist == (state_ ? 0xFFu : 0x00u);
+}
+
+BUTTON_DEBOUNCE_INLINE uint8_t ButtonDebounce::engineId()
+{
+    return kEngineEdgeGated;
+}
+
+#endif
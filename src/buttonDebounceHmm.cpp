@@ -0,0 +1,161 @@
+/**
+ * ButtonDebounce - HMM (Viterbi) Engine Implementation
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * Models the switch as a two-state hidden Markov chain: the real contact
+ * changes state with probability hmm_flip_pct per tick, and each sample
+ * reads the wrong level with probability hmm_noise_pct. A fixed-lag online
+ * Viterbi decode picks the most likely state sequence, so the decision
+ * follows from the noise model instead of a hand-tuned threshold.
+ *
+ * Algorithm:
+ * - Path costs are integer log-likelihoods (1/8 bit units) from a table
+ *   built at compile time; only the cost difference m1 - m0 is stored
+ * - Each tick, each state keeps its cheaper predecessor (stay, or switch
+ *   for the flip cost) and adds the noise cost if the sample disagrees
+ * - Each state's survivor path is an 8-bit shift register of states
+ * - Debounced level = state hmm_lag ticks ago on the cheaper path
+ *
+ * Notes:
+ * - hmm_flip_pct and hmm_noise_pct are clamped to 1..49, hmm_lag to 0..7
+ * - The output is the cheaper path hmm_lag ticks back. On a clean edge
+ *   the event comes max(hmm_lag, k0) ticks after the first sample of the
+ *   new level, k0 being the samples the decode needs to change its mind
+ *   (2 with the defaults); glitches the decode drops within the lag never
+ *   reach the output
+ * - Cost of update(): two compares, two selects, no multiply or divide
+ *
+ * Memory usage: 4 bytes (cost difference + 2 survivor paths + history)
+ * Debounce time: ~(hmm_lag + 1) * tick_interval on clean edges (defaults:
+ *   4 ticks), longer when noise makes the decode wait for evidence
+ */
+
+#include "ButtonDebounce.h"
+
+#if !defined(BUTTON_DEBOUNCE_HEADER_ONLY) || defined(BUTTON_DEBOUNCE_ENGINE_BODY)
+
+// Compile-time log2 (C++11 constexpr, recursion only): integer part by
+// halving, fraction bits by repeated squaring of the mantissa in [1, 2)
+static constexpr double hmmLog2Frac(double m, double bit, int n)
+{
+    return n == 0 ? 0.0
+         : (m * m >= 2.0) ? bit + hmmLog2Frac(m * m * 0.5, bit * 0.5, n - 1)
+                          : hmmLog2Frac(m * m, bit * 0.5, n - 1);
+}
+
+static constexpr double hmmLog2(double x)
+{
+    return x >= 2.0 ? 1.0 + hmmLog2(x * 0.5) : hmmLog2Frac(x, 0.5, 16);
+}
+
+static constexpr uint8_t hmmRound(double v)
+{
+    return v < 0.5 ? 1u : (uint8_t)(v + 0.5);
+}
+
+// Log-odds of an event with probability p%, in 1/8 bit:
+// round(8 * log2((100 - p) / p)), at least 1
+static constexpr uint8_t hmmCostOf(int p)
+{
+    return hmmRound(8.0 * hmmLog2((100.0 - p) / p));
+}
+
+static inline uint8_t hmmCost(uint8_t pct)
+{
+    static constexpr uint8_t kCost[50] = {
+        0,
+        hmmCostOf(1),  hmmCostOf(2),  hmmCostOf(3),  hmmCostOf(4),  hmmCostOf(5),
+        hmmCostOf(6),  hmmCostOf(7),  hmmCostOf(8),  hmmCostOf(9),  hmmCostOf(10),
+        hmmCostOf(11), hmmCostOf(12), hmmCostOf(13), hmmCostOf(14), hmmCostOf(15),
+        hmmCostOf(16), hmmCostOf(17), hmmCostOf(18), hmmCostOf(19), hmmCostOf(20),
+        hmmCostOf(21), hmmCostOf(22), hmmCostOf(23), hmmCostOf(24), hmmCostOf(25),
+        hmmCostOf(26), hmmCostOf(27), hmmCostOf(28), hmmCostOf(29), hmmCostOf(30),
+        hmmCostOf(31), hmmCostOf(32), hmmCostOf(33), hmmCostOf(34), hmmCostOf(35),
+        hmmCostOf(36), hmmCostOf(37), hmmCostOf(38), hmmCostOf(39), hmmCostOf(40),
+        hmmCostOf(41), hmmCostOf(42), hmmCostOf(43), hmmCostOf(44), hmmCostOf(45),
+        hmmCostOf(46), hmmCostOf(47), hmmCostOf(48), hmmCostOf(49)
+    };
+    static_assert(hmmCostOf(1) * 2 <= 127, "cost difference must fit int8_t");
+    return kCost[pct < 1u ? 1u : (pct > 49u ? 49u : pct)];
+}
+
+BUTTON_DEBOUNCE_INLINE ButtonDebounce::ButtonDebounce(const Config& cfg) : cfg_(cfg)
+{
+    reset(false);
+}
+
+BUTTON_DEBOUNCE_INLINE void ButtonDebounce::reset(bool start_down)
+{
+    state_ = start_down;
+    clearEvents();
+
+    // Fixed point of a line held at the start level
+    const int8_t full = (int8_t)(hmmCost(cfg_.hmm_flip_pct) + hmmCost(cfg_.hmm_noise_pct));
+    HmmState& h = eng_.hmm;
+    h.diff  = state_ ? (int8_t)-full : full;
+    h.path0 = state_ ? 0xFEu : 0x00u;
+    h.path1 = state_ ? 0xFFu : 0x01u;
+    h.hist  = state_ ? 0xFFu : 0x00u;
+}
+
+BUTTON_DEBOUNCE_INLINE void ButtonDebounce::update(bool raw_down)
+{
+    BUTTON_DEBOUNCE_PROFILE_SCOPE(profile());
+    beginTick();
+
+    HmmState& h = eng_.hmm;
+    update_hist(&h.hist, raw_down);
+
+    const int flip  = hmmCost(cfg_.hmm_flip_pct);
+    const int noise = hmmCost(cfg_.hmm_noise_pct);
+    const int d = h.diff;   // m1 - m0
+
+    // Cheaper predecessor of each state; ties keep the state
+    const bool stay0 = d >= -flip;   // m0 <= m1 + flip
+    const bool stay1 = d <= flip;    // m1 <= m0 + flip
+    const int a0 = stay0 ? 0 : d + flip;
+    const int a1 = stay1 ? d : flip;
+    h.diff = (int8_t)(a1 - a0 + (raw_down ? -noise : noise));
+
+    const uint8_t p0 = stay0 ? h.path0 : h.path1;
+    const uint8_t p1 = stay1 ? h.path1 : h.path0;
+    h.path0 = (uint8_t)(p0 << 1);
+    h.path1 = (uint8_t)((p1 << 1) | 1u);
+
+    // Decode hmm_lag ticks back along the cheaper path (tie: current level)
+    const uint8_t lag = cfg_.hmm_lag > 7u ? 7u : cfg_.hmm_lag;
+    const bool best1 = h.diff < 0 || (h.diff == 0 && state_);
+    const bool level = (((best1 ? h.path1 : h.path0) >> lag) & 1u) != 0u;
+    if (level == state_) return;
+
+    if (level) {
+        notePressed();
+    } else {
+        noteReleased();
+    }
+}
+
+BUTTON_DEBOUNCE_INLINE uint8_t ButtonDebounce::history() const
+{
+    return eng_.hmm.hist;
+}
+
+BUTTON_DEBOUNCE_INLINE bool ButtonDebounce::engineSettled() const
+{
+    // Full history agrees with the level and the decoder sits at the
+    // fixed point reset() uses for that level
+    const HmmState& h = eng_.hmm;
+    const int8_t full = (int8_t)(hmmCost(cfg_.hmm_flip_pct) + hmmCost(cfg_.hmm_noise_pct));
+    return state_ ? (h.hist == 0xFFu && h.diff == -full && h.path0 == 0xFEu && h.path1 == 0xFFu)
+                  : (h.hist == 0x00u && h.diff == full && h.path0 == 0x00u && h.path1 == 0x01u);
+}
+
+BUTTON_DEBOUNCE_INLINE uint8_t ButtonDebounce::engineId()
+{
+    return kEngineHmm;
+}
+
+#endif
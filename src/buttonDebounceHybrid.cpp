@@ -0,0 +1,165 @@
+/**
+ * ButtonDebounce - Hybrid Engine Implementation
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * Integrator hysteresis with edge-gated chatter suppression. The edge
+ * count of the sample history gates the accumulator: a noisy burst
+ * freezes it instead of walking it toward a threshold, and a burst that
+ * outlasts unstable_timeout recenters it to the debounced level.
+ *
+ * Algorithm:
+ * - Maintains 8-bit shift register of recent samples
+ * - Bouncing = edgeCount8(history) >= edge_threshold
+ * - While bouncing the accumulator holds; otherwise it moves as the
+ *   Integrator engine (integ_up / integ_down, saturating at 0 / integ_max)
+ * - Bouncing for unstable_timeout ticks -> history and accumulator
+ *   recenter to the debounced level (prevents lock-up)
+ * - Press at acc >= integ_on, release at acc <= integ_off
+ *
+ * Notes:
+ * - Uses the Integrator and Edge-gated Config fields; bounce_confirm is
+ *   not used (gating starts on the first bouncing tick)
+ * - BUTTON_DEBOUNCE_INTEGRATOR_16BIT widens the accumulator as for the
+ *   Integrator engine
+ * - BUTTON_DEBOUNCE_CONSTANT_TIME selects a branch-free update()
+ * - HybridBank<N> (ButtonDebounceHybridBank.h) runs the same filter on
+ *   whole port words
+ *
+ * Memory usage: 3 bytes (accumulator + history + timeout counter;
+ *               4 with BUTTON_DEBOUNCE_INTEGRATOR_16BIT)
+ * Debounce time: as the Integrator engine on clean edges, plus the
+ *                length of any chatter burst
+ */
+
+#include "ButtonDebounce.h"
+
+#if !defined(BUTTON_DEBOUNCE_HEADER_ONLY) || defined(BUTTON_DEBOUNCE_ENGINE_BODY)
+
+BUTTON_DEBOUNCE_INLINE ButtonDebounce::ButtonDebounce(const Config& cfg) : cfg_(cfg)
+{
+    reset(false);
+}
+
+BUTTON_DEBOUNCE_INLINE void ButtonDebounce::reset(bool start_down)
+{
+    state_ = start_down;
+    clearEvents();
+
+    eng_.hybrid.acc = state_ ? cfg_.integ_max : 0u;
+    eng_.hybrid.hist = state_ ? 0xFFu : 0x00u;
+    eng_.hybrid.unstable = 0u;
+}
+
+#if defined(BUTTON_DEBOUNCE_CONSTANT_TIME)
+
+// Constant-time variant: same behaviour, conditional-select arithmetic only.
+// The integrator step and the recenter are both computed every tick.
+BUTTON_DEBOUNCE_INLINE void ButtonDebounce::update(bool raw_down)
+{
+    BUTTON_DEBOUNCE_PROFILE_SCOPE(profile());
+    beginTick();
+
+    HybridState& h = eng_.hybrid;
+    update_hist(&h.hist, raw_down);
+
+    // Chatter detection and timeout (saturating counter)
+    const uint8_t bouncing = (uint8_t)(edgeCount8(h.hist) >= cfg_.edge_threshold);
+    const uint8_t us = select8(bouncing, (uint8_t)(h.unstable + (uint8_t)(h.unstable < 255u)), 0u);
+    const uint8_t timeout = (uint8_t)(us >= cfg_.unstable_timeout);
+
+    // Saturating integrator step, applied only when not bouncing
+    const uint32_t up = raw_down ? 1u : 0u;
+    const uint32_t acc = h.acc;
+    const uint32_t inc = min32(cfg_.integ_up, (uint32_t)cfg_.integ_max - acc);
+    const uint32_t dec = min32(cfg_.integ_down, acc);
+    const uint32_t step = (inc & (0u - up)) - (dec & (up - 1u));
+    const uint32_t moved = acc + (step & ((uint32_t)bouncing - 1u));
+
+    // Timeout -> recenter to current debounced state (prevents lock-up)
+    const uint32_t tm = 0u - (uint32_t)timeout;
+    const uint32_t rail = (uint32_t)cfg_.integ_max & (0u - (uint32_t)state_);
+    h.acc = (IntegValue)((rail & tm) | (moved & ~tm));
+    h.unstable = select8(timeout, 0u, us);
+    h.hist = select8(timeout, (uint8_t)(0u - (uint8_t)state_), h.hist);
+
+    // Hysteresis thresholds (skipped on a recenter tick)
+    const uint8_t live = (uint8_t)(timeout ^ 1u);
+    const uint8_t st = (uint8_t)state_;
+    noteEvents((uint8_t)(live & (st ^ 1u) & (uint8_t)(h.acc >= cfg_.integ_on)),
+               (uint8_t)(live & st & (uint8_t)(h.acc <= cfg_.integ_off)));
+}
+
+#else
+
+BUTTON_DEBOUNCE_INLINE void ButtonDebounce::update(bool raw_down)
+{
+    BUTTON_DEBOUNCE_PROFILE_SCOPE(profile());
+    beginTick();
+
+    HybridState& h = eng_.hybrid;
+    update_hist(&h.hist, raw_down);
+
+    // Detect chatter via edge count across the 8-sample window
+    const bool bouncing = edgeCount8(h.hist) >= cfg_.edge_threshold;
+    if (bouncing) {
+        if (h.unstable < 255u) h.unstable++;
+    } else {
+        h.unstable = 0u;
+    }
+
+    // Timeout -> recenter to current debounced state (prevents lock-up)
+    if (h.unstable >= cfg_.unstable_timeout) {
+        h.hist = state_ ? 0xFFu : 0x00u;
+        h.acc = state_ ? cfg_.integ_max : (IntegValue)0u;
+        h.unstable = 0u;
+        return;
+    }
+
+    // Saturating integrator, frozen while bouncing
+    if (!bouncing) {
+        if (raw_down) {
+            h.acc = (cfg_.integ_max - h.acc > cfg_.integ_up) ? (IntegValue)(h.acc + cfg_.integ_up)
+                                                             : cfg_.integ_max;
+        } else {
+            h.acc = (h.acc > cfg_.integ_down) ? (IntegValue)(h.acc - cfg_.integ_down) : (IntegValue)0u;
+        }
+    }
+
+    // Hysteresis thresholds
+    if (!state_ && h.acc >= cfg_.integ_on) {
+        notePressed();
+    } else if (state_ && h.acc <= cfg_.integ_off) {
+        noteReleased();
+    }
+}
+
+#endif
+
+BUTTON_DEBOUNCE_INLINE uint8_t ButtonDebounce::history() const
+{
+    return eng_.hybrid.hist;
+}
+
+BUTTON_DEBOUNCE_INLINE bool ButtonDebounce::engineSettled() const
+{
+    // Full history agrees with the level, no chatter being timed, and the
+    // accumulator railed on the level's side
+    const HybridState& h = eng_.hybrid;
+    return h.unstable == 0u && edgeCount8(h.hist) < cfg_.edge_threshold &&
+           h.hist == (state_ ? 0xFFu : 0x00u) &&
+           h.acc == (state_ ? cfg_.integ_max : (IntegValue)0u);
+}
+
+BUTTON_DEBOUNCE_INLINE uint8_t ButtonDebounce::engineId()
+{
+#if defined(BUTTON_DEBOUNCE_INTEGRATOR_16BIT)
+    return kEngineHybrid16;
+#else
+    return kEngineHybrid;
+#endif
+}
+
+#endif
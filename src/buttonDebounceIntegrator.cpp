@@ -9,53 +9,105 @@
  * Recommended for general-purpose debouncing.
  * 
  * Algorithm:
- * - Increments counter on press, decrements on release
+ * - Adds integ_up on press samples, subtracts integ_down on release
+ *   samples, saturating at 0 and integ_max
  * - Uses separate thresholds for press/release (hysteresis)
  * - Prevents oscillation around single threshold
  * 
- * Memory usage: 1 byte (accumulator)
- * Debounce time: integ_max * tick_interval
+ * - Unequal steps give asymmetric slew, e.g. integ_up = 4, integ_down = 1
+ *   for fast press detection and a slow, noise-resistant release
+ * - BUTTON_DEBOUNCE_INTEGRATOR_16BIT widens the accumulator to 16 bits
+ * - BUTTON_DEBOUNCE_CONSTANT_TIME selects a branch-free update()
+ * 
+ * Memory usage: 1 byte (accumulator; 2 with BUTTON_DEBOUNCE_INTEGRATOR_16BIT)
+ * Debounce time: integ_on / integ_up (press) and
+ *                (integ_max - integ_off) / integ_down (release) ticks
  */
 
 #include "ButtonDebounce.h"
 
-ButtonDebounce::ButtonDebounce(const Config& cfg) : cfg_(cfg)
+#if !defined(BUTTON_DEBOUNCE_HEADER_ONLY) || defined(BUTTON_DEBOUNCE_ENGINE_BODY)
+
+BUTTON_DEBOUNCE_INLINE ButtonDebounce::ButtonDebounce(const Config& cfg) : cfg_(cfg)
 {
     reset(false);
 }
 
-void ButtonDebounce::reset(bool start_down)
+BUTTON_DEBOUNCE_INLINE void ButtonDebounce::reset(bool start_down)
 {
     state_ = start_down;
-    pressed_ = false;
-    released_ = false;
+    clearEvents();
 
     eng_.integrator.acc = state_ ? cfg_.integ_max : 0u;
 }
 
-void ButtonDebounce::update(bool raw_down)
+#if defined(BUTTON_DEBOUNCE_CONSTANT_TIME)
+
+// Constant-time variant: same behaviour, conditional-select arithmetic only
+BUTTON_DEBOUNCE_INLINE void ButtonDebounce::update(bool raw_down)
+{
+    BUTTON_DEBOUNCE_PROFILE_SCOPE(profile());
+    beginTick();
+
+    IntegratorState& g = eng_.integrator;
+    const uint32_t up = raw_down ? 1u : 0u;
+    const uint32_t acc = g.acc;
+
+    // Saturating integrator: both clamped steps computed, one applied
+    const uint32_t inc = min32(cfg_.integ_up, (uint32_t)cfg_.integ_max - acc);
+    const uint32_t dec = min32(cfg_.integ_down, acc);
+    g.acc = (IntegValue)(acc + (inc & (0u - up)) - (dec & (up - 1u)));
+
+    // Hysteresis thresholds
+    const uint8_t st = (uint8_t)state_;
+    noteEvents((uint8_t)((st ^ 1u) & (uint8_t)(g.acc >= cfg_.integ_on)),
+               (uint8_t)(st & (uint8_t)(g.acc <= cfg_.integ_off)));
+}
+
+#else
+
+BUTTON_DEBOUNCE_INLINE void ButtonDebounce::update(bool raw_down)
 {
-    pressed_ = false;
-    released_ = false;
+    BUTTON_DEBOUNCE_PROFILE_SCOPE(profile());
+    beginTick();
 
-    // Saturating integrator
+    // Saturating integrator, weighted steps
+    IntegratorState& g = eng_.integrator;
     if (raw_down) {
-        if (eng_.integrator.acc < cfg_.integ_max) eng_.integrator.acc++;
+        g.acc = (cfg_.integ_max - g.acc > cfg_.integ_up) ? (IntegValue)(g.acc + cfg_.integ_up)
+                                                         : cfg_.integ_max;
     } else {
-        if (eng_.integrator.acc > 0u) eng_.integrator.acc--;
+        g.acc = (g.acc > cfg_.integ_down) ? (IntegValue)(g.acc - cfg_.integ_down) : (IntegValue)0u;
     }
 
     // Hysteresis thresholds
-    if (!state_ && eng_.integrator.acc >= cfg_.integ_on) {
-        state_ = true;
-        pressed_ = true;
-    } else if (state_ && eng_.integrator.acc <= cfg_.integ_off) {
-        state_ = false;
-        released_ = true;
+    if (!state_ && g.acc >= cfg_.integ_on) {
+        notePressed();
+    } else if (state_ && g.acc <= cfg_.integ_off) {
+        noteReleased();
     }
 }
 
-uint8_t ButtonDebounce::history() const
+#endif
+
+BUTTON_DEBOUNCE_INLINE uint8_t ButtonDebounce::history() const
 {
     return 0u; // integrator engine does not support history
-}
\ No newline at end of file
+}
+
+BUTTON_DEBOUNCE_INLINE bool ButtonDebounce::engineSettled() const
+{
+    // Railed accumulator: the last sample pushed it against a limit
+    return eng_.integrator.acc == 0u || eng_.integrator.acc == cfg_.integ_max;
+}
+
+BUTTON_DEBOUNCE_INLINE uint8_t ButtonDebounce::engineId()
+{
+#if defined(BUTTON_DEBOUNCE_INTEGRATOR_16BIT)
+    return kEngineIntegrator16;
+#else
+    return kEngineIntegrator;
+#endif
+}
+
+#endif
@@ -0,0 +1,81 @@
+/**
+ * ButtonDebounce - Leaky Integrator Engine Implementation
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * Exponentially weighted average of the raw samples with hysteresis.
+ * Unlike the unit-step integrator, old samples fade out geometrically, so
+ * sustained low-duty noise settles at its duty cycle instead of slowly
+ * walking the counter to a threshold.
+ *
+ * Algorithm:
+ * - y is a Q0.16 fraction (0 = always up, 0xFFFF = always down)
+ * - Each tick: y += (target - y) >> leak_shift, target 0 or 0xFFFF,
+ *   using only shifts and adds (no multiply)
+ * - Press when y >= leak_on, release when y <= leak_off
+ *
+ * Notes:
+ * - With the defaults (shift 2, 75% / 25%) a clean edge is accepted
+ *   after 5 ticks; noise below ~25% duty never presses
+ * - LeakyBank<N> (ButtonDebounceLeakyBank.h) runs the same filter on
+ *   16-bit SIMD lanes
+ *
+ * Memory usage: 4 bytes (average + history)
+ * Debounce time: ~1.4 * 2^leak_shift * tick_interval (default 75% / 25%)
+ */
+
+#include "ButtonDebounce.h"
+
+#if !defined(BUTTON_DEBOUNCE_HEADER_ONLY) || defined(BUTTON_DEBOUNCE_ENGINE_BODY)
+
+BUTTON_DEBOUNCE_INLINE ButtonDebounce::ButtonDebounce(const Config& cfg) : cfg_(cfg)
+{
+    reset(false);
+}
+
+BUTTON_DEBOUNCE_INLINE void ButtonDebounce::reset(bool start_down)
+{
+    state_ = start_down;
+    clearEvents();
+
+    eng_.leaky.y = state_ ? 0xFFFFu : 0x0000u;
+    eng_.leaky.hist = state_ ? 0xFFu : 0x00u;
+}
+
+BUTTON_DEBOUNCE_INLINE void ButtonDebounce::update(bool raw_down)
+{
+    BUTTON_DEBOUNCE_PROFILE_SCOPE(profile());
+    beginTick();
+
+    LeakyState& l = eng_.leaky;
+    update_hist(&l.hist, raw_down);
+    l.y = leakyStep(l.y, raw_down, cfg_.leak_shift);
+
+    // Hysteresis thresholds
+    if (!state_ && l.y >= cfg_.leak_on) {
+        notePressed();
+    } else if (state_ && l.y <= cfg_.leak_off) {
+        noteReleased();
+    }
+}
+
+BUTTON_DEBOUNCE_INLINE uint8_t ButtonDebounce::history() const
+{
+    return eng_.leaky.hist;
+}
+
+BUTTON_DEBOUNCE_INLINE bool ButtonDebounce::engineSettled() const
+{
+    // Full history agrees with the level and the average no longer moves
+    const LeakyState& l = eng_.leaky;
+    return l.hist == (state_ ? 0xFFu : 0x00u) && leakyStep(l.y, state_, cfg_.leak_shift) == l.y;
+}
+
+BUTTON_DEBOUNCE_INLINE uint8_t ButtonDebounce::engineId()
+{
+    return kEngineLeaky;
+}
+
+#endif
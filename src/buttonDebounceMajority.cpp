@@ -0,0 +1,81 @@
+/**
+ * ButtonDebounce - Majority Engine Implementation
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * Votes over a sliding window of recent samples. An isolated noisy
+ * sample costs nothing, unlike the consecutive engine where every
+ * glitch restarts the count.
+ *
+ * Algorithm:
+ * - Maintains 8-bit shift register of recent samples
+ * - votes = popcount of the newest maj_window samples
+ * - Press when votes >= maj_on, release when votes <= maj_off
+ * - The gap between maj_on and maj_off is the hysteresis
+ *
+ * Notes:
+ * - A clean edge is accepted after exactly maj_on (press) or
+ *   maj_window - maj_off (release) ticks, regardless of where in the
+ *   window a glitch lands
+ * - MajorityBank<N> (ButtonDebounceMajorityBank.h) computes the same
+ *   vote for whole port words with bit-sliced adders
+ *
+ * Memory usage: 4 bytes (history + unused counters)
+ * Debounce time: maj_on * tick_interval
+ */
+
+#include "ButtonDebounce.h"
+
+#if !defined(BUTTON_DEBOUNCE_HEADER_ONLY) || defined(BUTTON_DEBOUNCE_ENGINE_BODY)
+
+BUTTON_DEBOUNCE_INLINE ButtonDebounce::ButtonDebounce(const Config& cfg) : cfg_(cfg)
+{
+    reset(false);
+}
+
+BUTTON_DEBOUNCE_INLINE void ButtonDebounce::reset(bool start_down)
+{
+    state_ = start_down;
+    clearEvents();
+
+    eng_.history.hist = state_ ? 0xFFu : 0x00u;
+    eng_.history.unstable = 0u;
+    eng_.history.bounce_k = 0u;
+    eng_.history.lockout = 0u;
+}
+
+BUTTON_DEBOUNCE_INLINE void ButtonDebounce::update(bool raw_down)
+{
+    BUTTON_DEBOUNCE_PROFILE_SCOPE(profile());
+    beginTick();
+
+    update_hist(&eng_.history.hist, raw_down);
+
+    const uint8_t votes = popcount8((uint8_t)(eng_.history.hist & run_mask(cfg_.maj_window, 8u)));
+
+    if (!state_ && votes >= cfg_.maj_on) {
+        notePressed();
+    } else if (state_ && votes <= cfg_.maj_off) {
+        noteReleased();
+    }
+}
+
+BUTTON_DEBOUNCE_INLINE uint8_t ButtonDebounce::history() const
+{
+    return eng_.history.hist;
+}
+
+BUTTON_DEBOUNCE_INLINE bool ButtonDebounce::engineSettled() const
+{
+    // Full history agrees with the debounced level
+    return eng_.history.hist == (state_ ? 0xFFu : 0x00u);
+}
+
+BUTTON_DEBOUNCE_INLINE uint8_t ButtonDebounce::engineId()
+{
+    return kEngineMajority;
+}
+
+#endif
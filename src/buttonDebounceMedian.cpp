@@ -0,0 +1,89 @@
+/**
+ * ButtonDebounce - Median Engine Implementation
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * Median-of-N filter. On a binary signal the median is 1 exactly when
+ * more than half of the window is 1, so the filter reduces to a running
+ * count of ones compared against N/2.
+ *
+ * Algorithm:
+ * - Maintains 8-bit shift register of recent samples
+ * - Keeps the count of ones in the newest n samples: +1 for a 1 entering
+ *   the window, -1 for a 1 leaving it (O(1) per tick, no popcount)
+ * - Debounced level = ones > n / 2
+ *
+ * Notes:
+ * - n = med_n, odd, 1..7; even values round down, 0 becomes 1
+ * - Impulses shorter than (n + 1) / 2 ticks never reach the output
+ * - MedianBank<N> (ButtonDebounceMedianBank.h) runs the same filter on
+ *   whole port words
+ *
+ * Memory usage: 3 bytes (history + count + window)
+ * Debounce time: (med_n + 1) / 2 * tick_interval
+ */
+
+#include "ButtonDebounce.h"
+
+#if !defined(BUTTON_DEBOUNCE_HEADER_ONLY) || defined(BUTTON_DEBOUNCE_ENGINE_BODY)
+
+BUTTON_DEBOUNCE_INLINE ButtonDebounce::ButtonDebounce(const Config& cfg) : cfg_(cfg)
+{
+    reset(false);
+}
+
+BUTTON_DEBOUNCE_INLINE void ButtonDebounce::reset(bool start_down)
+{
+    state_ = start_down;
+    clearEvents();
+
+    // Odd window 1..7: even values round down, 0 becomes 1
+    uint8_t n = cfg_.med_n > 7u ? 7u : cfg_.med_n;
+    if ((n & 1u) == 0u) n = n ? (uint8_t)(n - 1u) : 1u;
+
+    eng_.median.n = n;
+    eng_.median.hist = state_ ? 0xFFu : 0x00u;
+    eng_.median.ones = state_ ? n : 0u;
+}
+
+BUTTON_DEBOUNCE_INLINE void ButtonDebounce::update(bool raw_down)
+{
+    BUTTON_DEBOUNCE_PROFILE_SCOPE(profile());
+    beginTick();
+
+    MedianState& m = eng_.median;
+
+    // Sample about to drop out of the window, then shift the new one in
+    const uint8_t leaving = (uint8_t)((m.hist >> (m.n - 1u)) & 1u);
+    update_hist(&m.hist, raw_down);
+    m.ones = (uint8_t)(m.ones + (raw_down ? 1u : 0u) - leaving);
+
+    const bool level = m.ones > (m.n >> 1);
+    if (level == state_) return;
+
+    if (level) {
+        notePressed();
+    } else {
+        noteReleased();
+    }
+}
+
+BUTTON_DEBOUNCE_INLINE uint8_t ButtonDebounce::history() const
+{
+    return eng_.median.hist;
+}
+
+BUTTON_DEBOUNCE_INLINE bool ButtonDebounce::engineSettled() const
+{
+    // Full history agrees with the debounced level
+    return eng_.median.hist == (state_ ? 0xFFu : 0x00u);
+}
+
+BUTTON_DEBOUNCE_INLINE uint8_t ButtonDebounce::engineId()
+{
+    return kEngineMedian;
+}
+
+#endif
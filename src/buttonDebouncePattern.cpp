@@ -0,0 +1,96 @@
+/**
+ * ButtonDebounce - Pattern-Mask Engine Implementation
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * Press and release are each a (care, match) rule over the sample
+ * history, tested with one AND and one compare. Generalizes the
+ * "00xxx111 / 11xxx000" idea: an edge is accepted only when the line was
+ * stable on the old side and is stable on the new side, with the bounce
+ * window in between ignored.
+ *
+ * Algorithm:
+ * - Maintains a BUTTON_DEBOUNCE_PATTERN_BITS-bit shift register of
+ *   recent samples (8 by default; 16, 32 or 64)
+ * - Up:   press   when (history & pat_press.care)   == pat_press.match
+ * - Down: release when (history & pat_release.care) == pat_release.match
+ *
+ * Notes:
+ * - Build rules with ButtonDebounce::pattern("00xxx111") (constexpr),
+ *   oldest sample first; e.g. pattern("111") is consec_n = 3
+ * - A rule whose care bits are all don't-care fires on the first tick
+ * - PatternBank<N> (ButtonDebouncePatternBank.h) evaluates the same
+ *   rules over bit-sliced histories
+ *
+ * Memory usage: 1 byte (history; 2 / 4 / 8 for wider histories)
+ * Debounce time: length of the newest run of care bits in the rule
+ *                (defaults: 3 ticks, with the 2 samples before the
+ *                bounce window required on the old level)
+ */
+
+#include "ButtonDebounce.h"
+
+#if !defined(BUTTON_DEBOUNCE_HEADER_ONLY) || defined(BUTTON_DEBOUNCE_ENGINE_BODY)
+
+BUTTON_DEBOUNCE_INLINE ButtonDebounce::ButtonDebounce(const Config& cfg) : cfg_(cfg)
+{
+    reset(false);
+}
+
+BUTTON_DEBOUNCE_INLINE void ButtonDebounce::reset(bool start_down)
+{
+    state_ = start_down;
+    clearEvents();
+
+    eng_.pattern.hist = state_ ? (PatternBits)~(PatternBits)0u : (PatternBits)0u;
+}
+
+BUTTON_DEBOUNCE_INLINE void ButtonDebounce::update(bool raw_down)
+{
+    BUTTON_DEBOUNCE_PROFILE_SCOPE(profile());
+    beginTick();
+
+    PatternState& p = eng_.pattern;
+    p.hist = (PatternBits)((PatternBits)(p.hist << 1) | (raw_down ? 1u : 0u));
+
+    // One rule per level: AND + compare
+    const Pattern& rule = state_ ? cfg_.pat_release : cfg_.pat_press;
+    if ((p.hist & rule.care) != rule.match) return;
+
+    if (state_) {
+        noteReleased();
+    } else {
+        notePressed();
+    }
+}
+
+BUTTON_DEBOUNCE_INLINE uint8_t ButtonDebounce::history() const
+{
+    return (uint8_t)eng_.pattern.hist;
+}
+
+BUTTON_DEBOUNCE_INLINE bool ButtonDebounce::engineSettled() const
+{
+    // Full history agrees with the level and the rule for leaving it does
+    // not match that history
+    const PatternBits rail = state_ ? (PatternBits)~(PatternBits)0u : (PatternBits)0u;
+    const Pattern& rule = state_ ? cfg_.pat_release : cfg_.pat_press;
+    return eng_.pattern.hist == rail && (rail & rule.care) != rule.match;
+}
+
+BUTTON_DEBOUNCE_INLINE uint8_t ButtonDebounce::engineId()
+{
+#if !defined(BUTTON_DEBOUNCE_PATTERN_BITS) || BUTTON_DEBOUNCE_PATTERN_BITS == 8
+    return kEnginePattern;
+#elif BUTTON_DEBOUNCE_PATTERN_BITS == 16
+    return kEnginePattern16;
+#elif BUTTON_DEBOUNCE_PATTERN_BITS == 32
+    return kEnginePattern32;
+#else
+    return kEnginePattern64;
+#endif
+}
+
+#endif
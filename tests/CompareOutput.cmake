@@ -0,0 +1,18 @@
+# Runs two test programs and fails unless both succeed with identical
+# output, ignoring the first line (build name).
+#
+#   cmake -DEXPECTED=<program> -DACTUAL=<program> -P CompareOutput.cmake
+
+foreach(side EXPECTED ACTUAL)
+    execute_process(COMMAND ${${side}} OUTPUT_VARIABLE out RESULT_VARIABLE rc)
+    if(NOT rc EQUAL 0)
+        message(FATAL_ERROR "${${side}} failed (${rc}):\n${out}")
+    endif()
+    string(REGEX REPLACE "^[^\n]*\n" "" out "${out}")
+    set(${side}_OUT "${out}")
+endforeach()
+
+if(NOT EXPECTED_OUT STREQUAL ACTUAL_OUT)
+    message(FATAL_ERROR "output differs\n${EXPECTED}:\n${EXPECTED_OUT}\n${ACTUAL}:\n${ACTUAL_OUT}")
+endif()
+message(STATUS "identical:\n${ACTUAL_OUT}")
@@ -0,0 +1,84 @@
+/**
+ * ButtonDebounce - Analog Bank Test
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * AnalogBank<N> against one AnalogDebounce per channel: filtered values
+ * and masks on every frame, for the SIMD path this binary was built with
+ * (CMake adds a scalar copy and, where the host runs it, an AVX2 copy).
+ * Thresholds cover the whole 0..0xFFFF range, including levels above
+ * 0x7FFF and the extremes. The channel count leaves a partial SIMD step.
+ */
+
+#include "test_common.h"
+#include "ButtonDebounceAnalogBank.h"
+
+#ifndef TEST_ANALOG_PATH
+#define TEST_ANALOG_PATH "default"
+#endif
+
+static const size_t   kN     = 45u;
+static const size_t   kWords = AnalogBank<kN>::kWords;
+static const uint32_t kTicks = 4000u;
+
+static const struct {
+    uint8_t  shift;
+    uint16_t press;
+    uint16_t release;
+} kLevels[] = {
+    { 2u, 2600u,   1500u },     // defaults
+    { 0u, 0x7FFFu, 0x7FFEu },   // no filter, top of the sample range
+    { 3u, 0x8000u, 0x7FFFu },   // press level just above any sample
+    { 1u, 0xFFFFu, 0x1000u },   // never pressed
+    { 4u, 0x0001u, 0x0000u },   // bottom of the range
+    { 2u, 0x0000u, 0x0000u },   // always pressed
+    { 5u, 0xC000u, 0xFFFEu },   // inverted levels, both above any sample
+};
+
+int main()
+{
+    for (size_t c = 0; c < sizeof(kLevels) / sizeof(kLevels[0]); c++) {
+        AnalogDebounce::Config cfg;
+        cfg.filter_shift = kLevels[c].shift;
+        cfg.press_level = kLevels[c].press;
+        cfg.release_level = kLevels[c].release;
+
+        AnalogBank<kN> bank(cfg);
+        AnalogDebounce single[kN];
+        for (size_t i = 0; i < kN; i++) single[i] = AnalogDebounce(cfg);
+
+        TestRng rng(31u + (uint32_t)c);
+        TestLine line[kN];
+        for (uint32_t t = 0; t < kTicks; t++) {
+            uint16_t frame[kN];
+            for (size_t i = 0; i < kN; i++) {
+                // Two-level signal with ADC noise, plus full-scale spikes
+                const uint32_t base = line[i].next(rng) ? 0x7000u : 0x0400u;
+                const uint32_t v = rng.chance(20u) ? (rng.next() & 0x7FFFu) : base + rng.below(0x0C00u);
+                frame[i] = (uint16_t)(v > 0x7FFFu ? 0x7FFFu : v);
+            }
+
+            bank.update(frame);
+            uint32_t dn[kWords] = { 0u }, pr[kWords] = { 0u }, rl[kWords] = { 0u };
+            for (size_t i = 0; i < kN; i++) {
+                single[i].update(frame[i]);
+                const uint32_t bit = 1u << (i & 31u);
+                if (single[i].down())     dn[i >> 5] |= bit;
+                if (single[i].pressed())  pr[i >> 5] |= bit;
+                if (single[i].released()) rl[i >> 5] |= bit;
+                TEST_CHECK(bank.value(i) == single[i].value(), "levels %u tick %lu channel %u: value %u/%u",
+                           (unsigned)c, (unsigned long)t, (unsigned)i, (unsigned)bank.value(i),
+                           (unsigned)single[i].value());
+            }
+            for (size_t w = 0; w < kWords; w++) {
+                TEST_CHECK(bank.downMask()[w] == dn[w] && bank.pressedMask()[w] == pr[w] &&
+                           bank.releasedMask()[w] == rl[w],
+                           "levels %u tick %lu word %u: down %08lx/%08lx", (unsigned)c, (unsigned long)t,
+                           (unsigned)w, (unsigned long)bank.downMask()[w], (unsigned long)dn[w]);
+            }
+        }
+    }
+    return testResult("test_analog " TEST_ANALOG_PATH);
+}
@@ -0,0 +1,138 @@
+/**
+ * ButtonDebounce - Bank Equivalence Test
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * For the engine this binary is linked against, on bouncing lines and
+ * every test Config:
+ * - ButtonBank (dense) matches one ButtonDebounce per lane
+ * - ButtonBank with setSkipSettled(true) matches the dense bank, latched
+ *   events included
+ * - the engine's word-parallel bank (bit-sliced or SIMD), if it has one,
+ *   matches the engine
+ *
+ * The last word is partly filled and the port words carry junk in the
+ * unused bits, and every other tick goes through updateActiveLow().
+ */
+
+#include "test_common.h"
+#include "ButtonDebounceBank.h"
+#include <memory>
+#if defined(TEST_ENGINE_MAJORITY)
+#include "ButtonDebounceMajorityBank.h"
+typedef MajorityBank<70> SlicedBank;
+#define TEST_SLICED_BANK 1
+#elif defined(TEST_ENGINE_MEDIAN)
+#include "ButtonDebounceMedianBank.h"
+typedef MedianBank<70> SlicedBank;
+#define TEST_SLICED_BANK 1
+#elif defined(TEST_ENGINE_PATTERN)
+#include "ButtonDebouncePatternBank.h"
+typedef PatternBank<70> SlicedBank;
+#define TEST_SLICED_BANK 1
+#elif defined(TEST_ENGINE_LEAKY)
+#include "ButtonDebounceLeakyBank.h"
+typedef LeakyBank<70> SlicedBank;
+#define TEST_SLICED_BANK 1
+#elif defined(TEST_ENGINE_HYBRID)
+#include "ButtonDebounceHybridBank.h"
+typedef HybridBank<70> SlicedBank;
+#define TEST_SLICED_BANK 1
+#endif
+
+static const size_t   kN     = 70u;
+static const size_t   kWords = ButtonBank<kN>::kWords;
+static const uint32_t kTicks = 6000u;
+
+template <class Bank>
+static void checkMasks(const Bank& bank, const uint32_t* dn, const uint32_t* pr, const uint32_t* rl,
+                       const char* what, size_t c, uint32_t t)
+{
+    for (size_t w = 0; w < kWords; w++) {
+        TEST_CHECK(bank.downMask()[w] == dn[w] && bank.pressedMask()[w] == pr[w] &&
+                   bank.releasedMask()[w] == rl[w],
+                   "%s cfg %u tick %lu word %u: down %08lx/%08lx pressed %08lx/%08lx released %08lx/%08lx",
+                   what, (unsigned)c, (unsigned long)t, (unsigned)w,
+                   (unsigned long)bank.downMask()[w], (unsigned long)dn[w],
+                   (unsigned long)bank.pressedMask()[w], (unsigned long)pr[w],
+                   (unsigned long)bank.releasedMask()[w], (unsigned long)rl[w]);
+    }
+}
+
+static void runConfig(size_t c)
+{
+    const ButtonDebounce::Config cfg = testConfig(c);
+
+    static ButtonDebounce single[kN];
+    for (size_t i = 0; i < kN; i++) single[i] = ButtonDebounce(cfg);
+    std::unique_ptr<ButtonBank<kN> > dense(new ButtonBank<kN>(cfg));
+    std::unique_ptr<ButtonBank<kN> > sparse(new ButtonBank<kN>(cfg));
+    sparse->setSkipSettled(true);
+#if defined(TEST_SLICED_BANK)
+    const bool sliced_ok = !cfg.latch_events;
+    SlicedBank sliced(cfg);
+#endif
+
+    TestRng rng(1234u + (uint32_t)c);
+    TestLine line[kN];
+    for (size_t i = 0; i < kN; i++) line[i] = TestLine((uint16_t)(i % 4u) * 10u);
+
+    for (uint32_t t = 0; t < kTicks; t++) {
+        uint32_t raw[kWords] = { 0u };
+        for (size_t i = 0; i < kN; i++) {
+            if (line[i].next(rng)) raw[i >> 5] |= 1u << (i & 31u);
+        }
+        raw[kWords - 1u] |= rng.next() & ~((1u << (kN & 31u)) - 1u);   // junk above lane kN
+
+        uint32_t dn[kWords] = { 0u }, pr[kWords] = { 0u }, rl[kWords] = { 0u };
+        for (size_t i = 0; i < kN; i++) {
+            single[i].update(((raw[i >> 5] >> (i & 31u)) & 1u) != 0u);
+            const uint32_t bit = 1u << (i & 31u);
+            if (single[i].down())     dn[i >> 5] |= bit;
+            if (single[i].pressed())  pr[i >> 5] |= bit;
+            if (single[i].released()) rl[i >> 5] |= bit;
+        }
+
+        if (t & 1u) {
+            uint32_t port[kWords];
+            for (size_t w = 0; w < kWords; w++) port[w] = ~raw[w];
+            dense->updateActiveLow(port);
+            sparse->updateActiveLow(port);
+        } else {
+            dense->update(raw);
+            sparse->update(raw);
+        }
+
+        checkMasks(*dense, dn, pr, rl, "dense bank vs engine", c, t);
+        checkMasks(*sparse, dn, pr, rl, "sparse bank vs engine", c, t);
+        for (size_t i = 0; i < kN; i++) {
+            TEST_CHECK((*dense)[i].history() == single[i].history(), "history cfg %u tick %lu lane %u",
+                       (unsigned)c, (unsigned long)t, (unsigned)i);
+        }
+
+#if defined(TEST_SLICED_BANK)
+        if (sliced_ok) {
+            sliced.update(raw);
+            checkMasks(sliced, dn, pr, rl, "sliced bank vs engine", c, t);
+        }
+#endif
+
+        if (cfg.latch_events) {
+            for (size_t i = 0; i < kN; i++) {
+                const unsigned m = testConsumeMask(t, i);
+                if (m == 0u) continue;
+                testConsume(single[i], m);
+                testConsume((*dense)[i], m);
+                testConsume((*sparse)[i], m);
+            }
+        }
+    }
+}
+
+int main()
+{
+    for (size_t c = 0; c < kTestConfigs; c++) runConfig(c);
+    return testResult("test_bank " TEST_ENGINE_NAME);
+}
@@ -0,0 +1,232 @@
+/**
+ * ButtonDebounce - Chord Test
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * ChordDetector on scripted down/pressed masks (N = 40, two words):
+ * - fires when every member is pressed within window_ticks, once
+ * - no fire when the window expires before the last member
+ * - disarms when a member is released before the chord completes
+ * - chords with members in both words
+ * - overlapping chords sharing a member, completing on different ticks
+ *   and on the same tick
+ * plus one pass through update(ButtonBank) on debounced input.
+ */
+
+#include "test_common.h"
+#include "ButtonDebounceChord.h"
+#include <memory>
+
+static const size_t kN = 40u;
+typedef ChordDetector<kN, 3> Chords;
+static const size_t kWords = Chords::kWords;
+
+// Debounced key state; pressed is derived per tick from down
+struct Keys {
+    uint32_t down[kWords];
+    uint32_t prev[kWords];
+
+    Keys()
+    {
+        for (size_t w = 0; w < kWords; w++) down[w] = prev[w] = 0u;
+    }
+
+    void press(size_t i)   { down[i >> 5] |= 1u << (i & 31u); }
+    void release(size_t i) { down[i >> 5] &= ~(1u << (i & 31u)); }
+
+    // One tick; returns the fired mask
+    uint32_t tick(Chords& chords)
+    {
+        uint32_t pressed[kWords];
+        for (size_t w = 0; w < kWords; w++) {
+            pressed[w] = down[w] & ~prev[w];
+            prev[w] = down[w];
+        }
+        chords.update(down, pressed);
+        return chords.firedMask();
+    }
+};
+
+static Chords::Chord chord(size_t a, size_t b, uint16_t window)
+{
+    Chords::Chord c;
+    for (size_t w = 0; w < kWords; w++) c.mask[w] = 0u;
+    c.mask[a >> 5] |= 1u << (a & 31u);
+    c.mask[b >> 5] |= 1u << (b & 31u);
+    c.window_ticks = window;
+    return c;
+}
+
+static Chords::Chord g_table[3];
+
+static void setTable(const Chords::Chord& c0, const Chords::Chord& c1, const Chords::Chord& c2)
+{
+    g_table[0] = c0;
+    g_table[1] = c1;
+    g_table[2] = c2;
+}
+
+// Idle chords that never match in the scenarios below
+static Chords::Chord unused() { return chord(38u, 39u, 1u); }
+
+static void testWindow()
+{
+    setTable(chord(0u, 1u, 6u), unused(), unused());
+
+    // Second member on the last tick of the window: fires, once
+    for (unsigned gap = 1u; gap <= 6u; gap++) {
+        Chords chords(g_table);
+        Keys k;
+        k.press(0u);
+        TEST_CHECK(k.tick(chords) == 0u, "gap %u: fired on the first member", gap);
+        for (unsigned t = 1u; t < gap; t++) TEST_CHECK(k.tick(chords) == 0u, "gap %u: early fire", gap);
+        k.press(1u);
+        TEST_CHECK(k.tick(chords) == 1u, "gap %u: no fire inside the window", gap);
+        for (unsigned t = 0u; t < 20u; t++) TEST_CHECK(k.tick(chords) == 0u, "gap %u: fired twice", gap);
+    }
+
+    // Both on the same tick
+    {
+        Chords chords(g_table);
+        Keys k;
+        k.press(0u);
+        k.press(1u);
+        TEST_CHECK(k.tick(chords) == 1u, "simultaneous press did not fire");
+    }
+
+    // One tick past the window: no fire, and the late member alone
+    // (which re-arms the chord) does not complete it either
+    {
+        Chords chords(g_table);
+        Keys k;
+        k.press(0u);
+        k.tick(chords);
+        for (unsigned t = 1u; t < 7u; t++) k.tick(chords);
+        k.press(1u);
+        for (unsigned t = 0u; t < 20u; t++) TEST_CHECK(k.tick(chords) == 0u, "fired after the window");
+    }
+}
+
+static void testEarlyRelease()
+{
+    setTable(chord(0u, 1u, 10u), unused(), unused());
+    Chords chords(g_table);
+    Keys k;
+
+    k.press(0u);
+    k.tick(chords);
+    k.release(0u);                        // released before the other member
+    TEST_CHECK(k.tick(chords) == 0u, "fired on release");
+    k.press(1u);
+    for (unsigned t = 0u; t < 20u; t++) TEST_CHECK(k.tick(chords) == 0u, "fired after early release");
+
+    // A member released on the tick the last one arrives: no fire
+    k.release(1u);
+    k.tick(chords);
+    k.press(0u);
+    k.tick(chords);
+    k.press(1u);
+    k.release(0u);
+    TEST_CHECK(k.tick(chords) == 0u, "fired with a member up");
+
+    // A clean press of both after all that fires
+    for (unsigned t = 0u; t < 12u; t++) k.tick(chords);
+    k.release(1u);
+    k.tick(chords);
+    k.press(0u);
+    k.press(1u);
+    TEST_CHECK(k.tick(chords) == 1u, "clean chord after early release did not fire");
+}
+
+static void testTwoWords()
+{
+    setTable(chord(3u, 35u, 4u), chord(31u, 32u, 4u), unused());
+    Chords chords(g_table);
+    Keys k;
+
+    k.press(35u);
+    TEST_CHECK(k.tick(chords) == 0u, "cross-word chord fired on one member");
+    k.tick(chords);
+    k.press(3u);
+    TEST_CHECK(k.tick(chords) == 1u, "cross-word chord 3+35 did not fire");
+
+    k.press(32u);
+    k.tick(chords);
+    k.release(32u);
+    k.tick(chords);
+    k.press(31u);
+    TEST_CHECK(k.tick(chords) == 0u, "31+32 fired after 32 was released");
+    k.press(32u);
+    TEST_CHECK(k.tick(chords) == 2u, "cross-word chord 31+32 did not fire");
+}
+
+static void testOverlap()
+{
+    setTable(chord(0u, 1u, 5u), chord(1u, 2u, 5u), unused());
+
+    // Shared member first: each chord fires when its own other member comes
+    {
+        Chords chords(g_table);
+        Keys k;
+        k.press(1u);
+        TEST_CHECK(k.tick(chords) == 0u, "overlap: fired on the shared member");
+        k.press(0u);
+        TEST_CHECK(k.tick(chords) == 1u, "overlap: 0+1 did not fire alone");
+        k.press(2u);
+        TEST_CHECK(k.tick(chords) == 2u, "overlap: 1+2 did not fire alone");
+    }
+
+    // All three at once: both fire on the same tick
+    {
+        Chords chords(g_table);
+        Keys k;
+        k.press(0u);
+        k.press(1u);
+        k.press(2u);
+        TEST_CHECK(k.tick(chords) == 3u, "overlap: both chords should fire together");
+        TEST_CHECK(k.tick(chords) == 0u, "overlap: fired again while held");
+    }
+
+    // Releasing the shared member disarms both
+    {
+        Chords chords(g_table);
+        Keys k;
+        k.press(1u);
+        k.tick(chords);
+        k.release(1u);
+        k.tick(chords);
+        k.press(0u);
+        k.press(2u);
+        for (unsigned t = 0u; t < 10u; t++) TEST_CHECK(k.tick(chords) == 0u, "overlap: fired without 1");
+    }
+}
+
+static void testBank()
+{
+    setTable(chord(5u, 36u, 6u), unused(), unused());
+    Chords chords(g_table);
+    std::unique_ptr<ButtonBank<kN> > bank(new ButtonBank<kN>());
+
+    unsigned fired = 0u;
+    for (unsigned t = 0u; t < 60u; t++) {
+        uint32_t raw[kWords] = { 0u };
+        if (t >= 10u && t < 40u) raw[0] |= 1u << 5;
+        if (t >= 12u && t < 40u) raw[1] |= 1u << 4;   // button 36
+        bank->update(raw);
+        chords.update(*bank);
+        fired += chords.fired(0) ? 1u : 0u;
+    }
+    TEST_CHECK(fired == 1u, "bank chord fired %u times", fired);
+}
+
+int main()
+{
+    testWindow();
+    testEarlyRelease();
+    testTwoWords();
+    testOverlap();
+    testBank();
+    return testResult("test_chord");
+}
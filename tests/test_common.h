@@ -0,0 +1,155 @@
+/**
+ * ButtonDebounce - Test Helpers
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * Shared pieces of the ctest programs: a check macro that counts failures,
+ * a small deterministic PRNG, a model of a bouncing switch line, and the
+ * Config set every engine test runs through.
+ *
+ * Each test is a plain executable: it prints the first few failures and
+ * returns non-zero if any check failed.
+ */
+
+#pragma once
+#include "ButtonDebounce.h"
+#include <stdint.h>
+#include <stdio.h>
+
+static int g_test_failures = 0;
+
+#define TEST_CHECK(cond, ...)                                               \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            if (g_test_failures < 20) {                                     \
+                printf("%s:%d: check failed: %s: ", __FILE__, __LINE__, #cond); \
+                printf(__VA_ARGS__);                                        \
+                printf("\n");                                               \
+            }                                                               \
+            g_test_failures++;                                              \
+        }                                                                   \
+    } while (0)
+
+static inline int testResult(const char* name)
+{
+    if (g_test_failures != 0) {
+        printf("%s: %d failure(s)\n", name, g_test_failures);
+        return 1;
+    }
+    printf("%s: ok\n", name);
+    return 0;
+}
+
+// xorshift32: same sequence on every host
+struct TestRng {
+    uint32_t s;
+
+    explicit TestRng(uint32_t seed) : s(seed ? seed : 1u) {}
+
+    uint32_t next()
+    {
+        s ^= s << 13;
+        s ^= s >> 17;
+        s ^= s << 5;
+        return s;
+    }
+
+    uint32_t below(uint32_t n) { return next() % n; }
+    bool chance(uint32_t permille) { return below(1000u) < permille; }
+};
+
+// One switch line: clean holds, a bounce burst after each edge, now and
+// then a long chatter burst (long enough for timeout recentering) and
+// single-tick glitches.
+struct TestLine {
+    bool     level;
+    uint16_t hold;
+    uint8_t  bounce;
+    uint16_t glitch_permille;
+    uint16_t max_hold;
+
+    explicit TestLine(uint16_t glitch = 10u, uint16_t longest = 64u)
+        : level(false), hold(0u), bounce(0u), glitch_permille(glitch), max_hold(longest) {}
+
+    bool next(TestRng& rng)
+    {
+        if (hold == 0u) {
+            level = !level;
+            hold = (uint16_t)(4u + rng.below(max_hold - 4u));
+            bounce = (uint8_t)(rng.chance(100u) ? 20u + rng.below(30u) : rng.below(10u));
+        }
+        hold--;
+
+        if (bounce != 0u) {
+            bounce--;
+            return (rng.next() & 1u) != 0u;
+        }
+        return level != rng.chance(glitch_permille);
+    }
+};
+
+// Config set shared by the engine tests. Every engine reads only its own
+// fields, so each entry exercises all engines at once. The latched entry
+// is last (the bit-sliced banks have no latched mode).
+static const size_t kTestConfigs = 5u;
+
+static inline ButtonDebounce::Config testConfig(size_t i)
+{
+    ButtonDebounce::Config c;
+    switch (i) {
+    case 1:
+        c.integ_max = 10; c.integ_on = 7; c.integ_off = 3; c.integ_up = 2; c.integ_down = 1;
+        c.consec_n = 4; c.press_n = 2; c.release_n = 5;
+        c.edge_threshold = 3; c.unstable_timeout = 6; c.bounce_confirm = 2;
+        c.adapt_min = 3; c.adapt_max = 6;
+        c.maj_window = 7; c.maj_on = 5; c.maj_off = 2;
+        c.med_n = 3;
+        c.leak_shift = 3; c.leak_on = 0xA000u; c.leak_off = 0x3000u;
+        c.hmm_flip_pct = 5; c.hmm_noise_pct = 30; c.hmm_lag = 0;
+        c.pat_press = ButtonDebounce::pattern("0x11");
+        c.pat_release = ButtonDebounce::pattern("1x00");
+        break;
+    case 2:
+        c.integ_up = 3; c.integ_down = 2;
+        c.eager_press = true; c.lockout_ticks = 4;
+        c.edge_threshold = 2; c.unstable_timeout = 3;
+        c.maj_window = 3; c.maj_on = 2; c.maj_off = 1;
+        c.med_n = 7;
+        c.leak_shift = 1;
+        c.hmm_lag = 7;
+        c.pat_press = ButtonDebounce::pattern("111");
+        c.pat_release = ButtonDebounce::pattern("000");
+        break;
+    case 3:
+        c.eager_release = true; c.lockout_ticks = 0; c.release_n = 2;
+        c.bounce_confirm = 0;
+        c.maj_window = 8; c.maj_on = 8; c.maj_off = 0;
+        c.med_n = 1;
+        c.leak_shift = 0;
+        c.hmm_flip_pct = 1; c.hmm_noise_pct = 45; c.hmm_lag = 4;
+        c.pat_press = ButtonDebounce::pattern("0_1");
+        c.pat_release = ButtonDebounce::pattern("x");
+        break;
+    case 4:
+        c.latch_events = true;
+        break;
+    default:
+        break;
+    }
+    return c;
+}
+
+// Latched configs: events consumed on tick t for a lane (bit 0 press,
+// bit 1 release), on a fixed schedule so pending counts move
+static inline unsigned testConsumeMask(uint32_t tick, size_t lane)
+{
+    return ((((tick + lane) % 7u) == 0u) ? 1u : 0u) | ((((tick + lane) % 11u) == 0u) ? 2u : 0u);
+}
+
+static inline void testConsume(ButtonDebounce& btn, unsigned mask)
+{
+    if (mask & 1u) btn.consumePressed();
+    if (mask & 2u) btn.consumeReleased();
+}
@@ -0,0 +1,165 @@
+/**
+ * ButtonDebounce - Encoder Test
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * EncoderBank<N> against one QuadratureDecoder per lane on modelled
+ * rotary encoders: runs of turning in either direction at varying speed,
+ * contact bounce on the channel that just changed, idle spells longer
+ * than velocity_timeout, and glitches where both channels flip at once.
+ * Steps, invalid flags, positions and velocities must match on every
+ * tick for several detent and timeout settings, including both ends of
+ * steps_per_detent (1 and 7) and values outside it, which both classes
+ * clamp. Every other tick goes through updateActiveLow() and the port
+ * words carry junk above lane N.
+ */
+
+#include "test_common.h"
+#include "ButtonDebounceEncoder.h"
+
+static const size_t   kN     = 70u;
+static const size_t   kWords = EncoderBank<kN>::kWords;
+static const uint32_t kTicks = 20000u;
+
+// One encoder: quarter-step shaft position, Gray-coded onto A/B
+struct EncoderLine {
+    uint32_t pos;
+    int      dir;
+    uint16_t run;      // quarter steps left in this run
+    uint8_t  period;   // ticks per quarter step
+    uint8_t  wait;
+    uint16_t idle;
+    uint8_t  bounce;
+    uint8_t  changed;  // channel bit that changed last
+
+    EncoderLine() : pos(0u), dir(1), run(0u), period(1u), wait(0u), idle(0u), bounce(0u), changed(1u) {}
+
+    uint8_t next(TestRng& rng)
+    {
+        static const uint8_t kGray[4] = { 0u, 1u, 3u, 2u };
+
+        if (idle != 0u) {
+            idle--;
+        } else if (run == 0u) {
+            dir = rng.chance(500u) ? 1 : -1;
+            run = (uint16_t)(1u + rng.below(40u));
+            period = (uint8_t)(1u + rng.below(12u));
+            if (rng.chance(200u)) idle = (uint16_t)(rng.below(300u));
+        } else if (wait != 0u) {
+            wait--;
+        } else {
+            const uint8_t before = kGray[pos & 3u];
+            pos += (uint32_t)dir;
+            run--;
+            wait = period;
+            changed = (uint8_t)(before ^ kGray[pos & 3u]);
+            bounce = (uint8_t)(period > 3u ? rng.below(period - 2u) : 0u);
+        }
+
+        uint8_t ab = kGray[pos & 3u];
+        if (bounce != 0u) {
+            bounce--;
+            if (rng.next() & 1u) ab ^= changed;   // only the channel that moved bounces
+        }
+        if (rng.chance(3u)) ab ^= 3u;             // missed sample / glitch: both flip
+        return ab;
+    }
+};
+
+static void run(uint8_t steps_per_detent, uint16_t velocity_timeout)
+{
+    QuadratureDecoder::Config cfg;
+    cfg.steps_per_detent = steps_per_detent;
+    cfg.velocity_timeout = velocity_timeout;
+
+    // Out-of-range settings must behave like the nearest end of 1..7
+    QuadratureDecoder::Config edge_cfg = cfg;
+    edge_cfg.steps_per_detent = steps_per_detent < 1u ? 1u : (steps_per_detent > 7u ? 7u : steps_per_detent);
+
+    static QuadratureDecoder single[kN];
+    static QuadratureDecoder edge[kN];
+    for (size_t i = 0; i < kN; i++) {
+        single[i] = QuadratureDecoder(cfg);
+        edge[i] = QuadratureDecoder(edge_cfg);
+    }
+    static EncoderBank<kN> bank;
+    bank = EncoderBank<kN>(cfg);
+
+    TestRng rng(50u + steps_per_detent * 31u + velocity_timeout);
+    EncoderLine line[kN];
+    uint32_t steps = 0u, invalids = 0u;
+
+    for (uint32_t t = 0; t < kTicks; t++) {
+        uint32_t a[kWords] = { 0u }, b[kWords] = { 0u };
+        uint32_t fw[kWords] = { 0u }, bw[kWords] = { 0u }, inv[kWords] = { 0u };
+
+        for (size_t i = 0; i < kN; i++) {
+            const uint8_t ab = line[i].next(rng);
+            const uint32_t bit = 1u << (i & 31u);
+            if (ab & 2u) a[i >> 5] |= bit;
+            if (ab & 1u) b[i >> 5] |= bit;
+
+            single[i].update((ab & 2u) != 0u, (ab & 1u) != 0u);
+            edge[i].update((ab & 2u) != 0u, (ab & 1u) != 0u);
+            TEST_CHECK(single[i].step() == edge[i].step() && single[i].position() == edge[i].position(),
+                       "detent %u tick %lu lane %u: decoder differs from detent %u",
+                       (unsigned)steps_per_detent, (unsigned long)t, (unsigned)i,
+                       (unsigned)edge_cfg.steps_per_detent);
+            if (single[i].step() > 0) fw[i >> 5] |= bit;
+            if (single[i].step() < 0) bw[i >> 5] |= bit;
+            if (single[i].invalid())  inv[i >> 5] |= bit;
+            steps += single[i].step() != 0 ? 1u : 0u;
+            invalids += single[i].invalid() ? 1u : 0u;
+        }
+        const uint32_t junk = ~((1u << (kN & 31u)) - 1u);
+        a[kWords - 1u] |= rng.next() & junk;
+        b[kWords - 1u] |= rng.next() & junk;
+
+        if (t & 1u) {
+            uint32_t a_port[kWords], b_port[kWords];
+            for (size_t w = 0; w < kWords; w++) {
+                a_port[w] = ~a[w];
+                b_port[w] = ~b[w];
+            }
+            bank.updateActiveLow(a_port, b_port);
+        } else {
+            bank.update(a, b);
+        }
+
+        for (size_t w = 0; w < kWords; w++) {
+            TEST_CHECK(bank.forwardMask()[w] == fw[w] && bank.backwardMask()[w] == bw[w] &&
+                       bank.invalidMask()[w] == inv[w],
+                       "detent %u tick %lu word %u: fwd %08lx/%08lx back %08lx/%08lx invalid %08lx/%08lx",
+                       (unsigned)steps_per_detent, (unsigned long)t, (unsigned)w,
+                       (unsigned long)bank.forwardMask()[w], (unsigned long)fw[w],
+                       (unsigned long)bank.backwardMask()[w], (unsigned long)bw[w],
+                       (unsigned long)bank.invalidMask()[w], (unsigned long)inv[w]);
+        }
+        for (size_t i = 0; i < kN; i++) {
+            TEST_CHECK(bank.position(i) == single[i].position() && bank.velocity(i) == single[i].velocity(),
+                       "detent %u tick %lu lane %u: position %ld/%ld velocity %ld/%ld",
+                       (unsigned)steps_per_detent, (unsigned long)t, (unsigned)i,
+                       (long)bank.position(i), (long)single[i].position(),
+                       (long)bank.velocity(i), (long)single[i].velocity());
+        }
+    }
+
+    TEST_CHECK(steps != 0u && invalids != 0u, "detent %u: %lu steps, %lu invalid",
+               (unsigned)steps_per_detent, (unsigned long)steps, (unsigned long)invalids);
+}
+
+int main()
+{
+    run(4u, 100u);
+    run(2u, 100u);
+    run(1u, 20u);
+    run(3u, 1u);
+    run(7u, 500u);
+    run(0u, 100u);     // clamped to 1
+    run(8u, 100u);     // clamped to 7
+    run(127u, 100u);
+    run(255u, 30u);
+    return testResult("test_encoder");
+}
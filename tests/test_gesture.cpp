@@ -0,0 +1,75 @@
+/**
+ * ButtonDebounce - Gesture Bank Test
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * GestureBank<N> against one GestureDetector per lane, both fed by the
+ * same ButtonBank, for several gesture timings (including disabled
+ * gestures and immediate clicks). Holds are long enough to reach
+ * LongPress and Repeat.
+ */
+
+#include "test_common.h"
+#include "ButtonDebounceGesture.h"
+#include <memory>
+
+static const size_t   kN     = 70u;
+static const size_t   kWords = ButtonBank<kN>::kWords;
+static const uint32_t kTicks = 20000u;
+
+static GestureDetector::Config gestureConfig(size_t i)
+{
+    GestureDetector::Config g;
+    switch (i) {
+    case 1:  g.long_ticks = 30u; g.repeat_ticks = 7u; g.multi_gap_ticks = 15u; break;
+    case 2:  g.long_ticks = 25u; g.repeat_ticks = 0u; g.multi_gap_ticks = 0u;  break;
+    case 3:  g.long_ticks = 0u;  g.repeat_ticks = 5u; g.multi_gap_ticks = 40u; break;
+    default: break;
+    }
+    return g;
+}
+
+int main()
+{
+    for (size_t c = 0; c < 4u; c++) {
+        const GestureDetector::Config gcfg = gestureConfig(c);
+        std::unique_ptr<ButtonBank<kN> > bank(new ButtonBank<kN>());
+        GestureBank<kN> gestures(gcfg);
+        GestureDetector single[kN];
+        for (size_t i = 0; i < kN; i++) single[i] = GestureDetector(gcfg);
+
+        TestRng rng(4242u + (uint32_t)c);
+        TestLine line[kN];
+        for (size_t i = 0; i < kN; i++) line[i] = TestLine(5u, (uint16_t)(i & 1u ? 160u : 40u));
+
+        uint32_t events[5] = { 0u };
+        for (uint32_t t = 0; t < kTicks; t++) {
+            uint32_t raw[kWords] = { 0u };
+            for (size_t i = 0; i < kN; i++) {
+                if (line[i].next(rng)) raw[i >> 5] |= 1u << (i & 31u);
+            }
+            bank->update(raw);
+            gestures.update(*bank);
+
+            for (size_t i = 0; i < kN; i++) {
+                const GestureDetector::Event want = single[i].update((*bank)[i]);
+                const GestureDetector::Event got = gestures.event(i);
+                TEST_CHECK(want == got, "cfg %u tick %lu lane %u: event %u, expected %u",
+                           (unsigned)c, (unsigned long)t, (unsigned)i, (unsigned)got, (unsigned)want);
+                events[want]++;
+            }
+        }
+
+        // Every gesture the Config enables must actually occur
+        TEST_CHECK(events[GestureDetector::Click] != 0u, "cfg %u: no clicks", (unsigned)c);
+        TEST_CHECK(gcfg.multi_gap_ticks == 0u || events[GestureDetector::DoubleClick] != 0u,
+                   "cfg %u: no double clicks", (unsigned)c);
+        TEST_CHECK(gcfg.long_ticks == 0u || events[GestureDetector::LongPress] != 0u,
+                   "cfg %u: no long presses", (unsigned)c);
+        TEST_CHECK(gcfg.long_ticks == 0u || gcfg.repeat_ticks == 0u || events[GestureDetector::Repeat] != 0u,
+                   "cfg %u: no repeats", (unsigned)c);
+    }
+    return testResult("test_gesture");
+}
@@ -0,0 +1,154 @@
+/**
+ * ButtonDebounce - HMM Engine Test
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * The HMM engine against a plain reference decoder:
+ * - cost table from std::log2 (checks the compile-time log2)
+ * - absolute path costs for both states instead of their difference
+ * - survivor paths as arrays of states, read hmm_lag ticks back
+ * The two must agree tick for tick on noisy lines for every flip / noise /
+ * lag combination tried.
+ *
+ * Fixed delay: on a clean step the decode needs k0 samples of evidence
+ * (the delay at hmm_lag 0); with hmm_lag L the event comes exactly
+ * max(L, k0) ticks after the edge, for every flip / noise pair.
+ */
+
+#include "test_common.h"
+#include <math.h>
+#include <string.h>
+
+static const unsigned kDepth = 8u;   // survivor depth the engine keeps
+
+static int costOf(unsigned pct)
+{
+    const double v = 8.0 * log2((100.0 - pct) / pct);
+    return v < 0.5 ? 1 : (int)(v + 0.5);
+}
+
+struct RefHmm {
+    int     flip, noise;
+    unsigned lag;
+    long    m0, m1;              // path costs, lower is likelier
+    uint8_t path0[kDepth];       // [0] = current tick
+    uint8_t path1[kDepth];
+    bool    level;
+
+    RefHmm(const ButtonDebounce::Config& cfg, bool start)
+        : flip(costOf(cfg.hmm_flip_pct)), noise(costOf(cfg.hmm_noise_pct)),
+          lag(cfg.hmm_lag), level(start)
+    {
+        // Line held at the start level forever: the other state is one
+        // flip plus one wrong read behind
+        m0 = start ? flip + noise : 0;
+        m1 = start ? 0 : flip + noise;
+        for (unsigned i = 0; i < kDepth; i++) path0[i] = path1[i] = start ? 1u : 0u;
+        path0[0] = 0u;
+        path1[0] = 1u;
+    }
+
+    // Returns 1 on a press, 2 on a release
+    unsigned step(bool raw)
+    {
+        const bool stay0 = m0 <= m1 + flip;
+        const bool stay1 = m1 <= m0 + flip;
+        const long n0 = (stay0 ? m0 : m1 + flip) + (raw ? noise : 0);
+        const long n1 = (stay1 ? m1 : m0 + flip) + (raw ? 0 : noise);
+
+        uint8_t p0[kDepth], p1[kDepth];
+        memcpy(p0 + 1, stay0 ? path0 : path1, kDepth - 1u);
+        memcpy(p1 + 1, stay1 ? path1 : path0, kDepth - 1u);
+        p0[0] = 0u;
+        p1[0] = 1u;
+        memcpy(path0, p0, kDepth);
+        memcpy(path1, p1, kDepth);
+
+        // Only the difference matters; keep the numbers small
+        const long base = n0 < n1 ? n0 : n1;
+        m0 = n0 - base;
+        m1 = n1 - base;
+
+        const bool best1 = m1 < m0 || (m1 == m0 && level);
+        const bool next = (best1 ? path1 : path0)[lag] != 0u;
+        if (next == level) return 0u;
+        level = next;
+        return next ? 1u : 2u;
+    }
+};
+
+static ButtonDebounce::Config hmmConfig(unsigned flip, unsigned noise, unsigned lag)
+{
+    ButtonDebounce::Config cfg;
+    cfg.hmm_flip_pct = (uint8_t)flip;
+    cfg.hmm_noise_pct = (uint8_t)noise;
+    cfg.hmm_lag = (uint8_t)lag;
+    return cfg;
+}
+
+static void testReference()
+{
+    TestRng rng(45u);
+
+    for (unsigned run = 0; run < 300u; run++) {
+        const unsigned flip = 1u + rng.below(49u);
+        const unsigned noise = 1u + rng.below(49u);
+        const unsigned lag = run % 8u;
+        const ButtonDebounce::Config cfg = hmmConfig(flip, noise, lag);
+        const bool start = (run & 8u) != 0u;
+
+        ButtonDebounce btn(cfg);
+        btn.reset(start);
+        RefHmm ref(cfg, start);
+        TestLine line((uint16_t)(run % 40u) * 5u);
+
+        for (uint32_t t = 0; t < 2000u; t++) {
+            const bool raw = line.next(rng);
+            btn.update(raw);
+            const unsigned ev = ref.step(raw);
+            TEST_CHECK(btn.down() == ref.level && btn.pressed() == (ev == 1u) &&
+                       btn.released() == (ev == 2u),
+                       "flip %u noise %u lag %u tick %lu: level %d/%d event %u",
+                       flip, noise, lag, (unsigned long)t, (int)btn.down(), (int)ref.level, ev);
+        }
+    }
+}
+
+// Ticks from the first sample of a clean step to its event, or -1
+static int stepDelay(const ButtonDebounce::Config& cfg, bool to_down)
+{
+    ButtonDebounce btn(cfg);
+    btn.reset(!to_down);
+    for (int t = 0; t < 64; t++) {
+        btn.update(to_down);
+        if (btn.pressed() || btn.released()) return t;
+    }
+    return -1;
+}
+
+static void testFixedDelay()
+{
+    for (unsigned flip = 1u; flip <= 49u; flip++) {
+        for (unsigned noise = 1u; noise <= 49u; noise++) {
+            for (int dir = 0; dir < 2; dir++) {
+                const int k0 = stepDelay(hmmConfig(flip, noise, 0u), dir != 0);
+                TEST_CHECK(k0 >= 0, "flip %u noise %u: clean step never decoded", flip, noise);
+                for (unsigned lag = 1u; lag < kDepth; lag++) {
+                    const int d = stepDelay(hmmConfig(flip, noise, lag), dir != 0);
+                    const int want = (int)lag > k0 ? (int)lag : k0;
+                    TEST_CHECK(d == want, "flip %u noise %u lag %u dir %d: delay %d, expected %d",
+                               flip, noise, lag, dir, d, want);
+                }
+            }
+        }
+    }
+}
+
+int main()
+{
+    testReference();
+    testFixedDelay();
+    return testResult("test_hmm " TEST_ENGINE_NAME);
+}
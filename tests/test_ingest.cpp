@@ -0,0 +1,125 @@
+/**
+ * ButtonDebounce - DMA Ingestion Test
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * BankIngest<N> over a simulated ping-pong DMA buffer against a bank fed
+ * frame by frame:
+ * - the bank ends each batch in the same state as the reference
+ * - pressedMask()/releasedMask() hold every event of the batch, with and
+ *   without an event handler
+ * - the handler runs once per frame that had an event, with that frame's
+ *   masks
+ * - a half completed twice before process() counts one overrun
+ */
+
+#include "test_common.h"
+#include "ButtonDebounceIngest.h"
+#include <memory>
+#include <string.h>
+
+static const size_t kN      = 40u;
+static const size_t kWords  = ButtonBank<kN>::kWords;
+static const size_t kFrames = 16u;   // frames per half
+
+struct HandlerLog {
+    uint32_t calls;
+    uint32_t pressed[kWords];
+};
+
+static void onEvent(const ButtonBank<kN>& bank, void* ctx)
+{
+    HandlerLog& log = *(HandlerLog*)ctx;
+    log.calls++;
+    for (size_t w = 0; w < kWords; w++) log.pressed[w] |= bank.pressedMask()[w];
+}
+
+static void run(bool with_handler, bool active_low)
+{
+    static uint32_t dma[2 * kFrames * kWords];
+    std::unique_ptr<ButtonBank<kN> > bank(new ButtonBank<kN>());
+    std::unique_ptr<ButtonBank<kN> > ref(new ButtonBank<kN>());
+    BankIngest<kN> ingest(*bank, dma, kFrames, active_low);
+    HandlerLog log;
+    memset(&log, 0, sizeof(log));
+    if (with_handler) ingest.setEventHandler(onEvent, &log);
+
+    TestRng rng(5u);
+    unsigned next_half = 0u;
+    TestLine line[kN];
+    for (size_t i = 0; i < kN; i++) line[i] = TestLine(5u, 24u);
+
+    for (uint32_t batch = 0; batch < 400u; batch++) {
+        // DMA fills one or both halves (in order) before the CPU gets to run
+        const unsigned halves = 1u + (batch % 3u == 0u ? 1u : 0u);
+        uint32_t pr[kWords] = { 0u }, rl[kWords] = { 0u };
+        uint32_t event_frames = 0u;
+
+        for (unsigned k = 0; k < halves; k++) {
+            uint32_t* half = dma + (size_t)next_half * kFrames * kWords;
+            for (size_t t = 0; t < kFrames; t++) {
+                uint32_t raw[kWords] = { 0u };
+                for (size_t i = 0; i < kN; i++) {
+                    if (line[i].next(rng)) raw[i >> 5] |= 1u << (i & 31u);
+                }
+                for (size_t w = 0; w < kWords; w++) half[t * kWords + w] = active_low ? ~raw[w] : raw[w];
+
+                ref->update(raw);
+                uint32_t any = 0u;
+                for (size_t w = 0; w < kWords; w++) {
+                    pr[w] |= ref->pressedMask()[w];
+                    rl[w] |= ref->releasedMask()[w];
+                    any |= ref->pressedMask()[w] | ref->releasedMask()[w];
+                }
+                if (any) event_frames++;
+            }
+            if (next_half == 0u) ingest.onHalfComplete(); else ingest.onComplete();
+            next_half ^= 1u;
+        }
+
+        const uint32_t calls_before = log.calls;
+        memset(log.pressed, 0, sizeof(log.pressed));
+        const size_t frames = ingest.process();
+        TEST_CHECK(frames == halves * kFrames, "batch %lu: %lu frames", (unsigned long)batch,
+                   (unsigned long)frames);
+
+        for (size_t w = 0; w < kWords; w++) {
+            TEST_CHECK(ingest.pressedMask()[w] == pr[w] && ingest.releasedMask()[w] == rl[w],
+                       "batch %lu word %u: pressed %08lx/%08lx released %08lx/%08lx",
+                       (unsigned long)batch, (unsigned)w,
+                       (unsigned long)ingest.pressedMask()[w], (unsigned long)pr[w],
+                       (unsigned long)ingest.releasedMask()[w], (unsigned long)rl[w]);
+            TEST_CHECK(bank->downMask()[w] == ref->downMask()[w], "batch %lu word %u: level differs",
+                       (unsigned long)batch, (unsigned)w);
+            if (with_handler) {
+                TEST_CHECK(log.pressed[w] == pr[w], "batch %lu word %u: handler saw %08lx, expected %08lx",
+                           (unsigned long)batch, (unsigned)w, (unsigned long)log.pressed[w],
+                           (unsigned long)pr[w]);
+            }
+        }
+        if (with_handler) {
+            TEST_CHECK(log.calls - calls_before == event_frames, "batch %lu: %lu handler calls, expected %lu",
+                       (unsigned long)batch, (unsigned long)(log.calls - calls_before),
+                       (unsigned long)event_frames);
+        }
+    }
+    TEST_CHECK(ingest.overruns() == 0u, "%lu unexpected overruns", (unsigned long)ingest.overruns());
+
+    // A half completing twice before process() runs once and is one overrun
+    ingest.reset();
+    ingest.onHalfComplete();
+    ingest.onComplete();
+    ingest.onHalfComplete();
+    TEST_CHECK(ingest.process() == 2u * kFrames, "overrun batch size");
+    TEST_CHECK(ingest.overruns() == 1u, "%lu overruns, expected 1", (unsigned long)ingest.overruns());
+}
+
+int main()
+{
+    run(false, false);
+    run(true, false);
+    run(false, true);
+    return testResult("test_ingest");
+}
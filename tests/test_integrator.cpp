@@ -0,0 +1,84 @@
+/**
+ * ButtonDebounce - Weighted Integrator Test
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * The integrator engine this binary is linked against (8- or 16-bit
+ * accumulator, branchy or constant-time) against a plain reference model
+ * of the documented rule: add integ_up per down sample, subtract
+ * integ_down per up sample, saturate at 0 and integ_max, press at
+ * integ_on, release at integ_off. Random parameter sets span the whole
+ * IntegValue range, including steps larger than integ_max.
+ */
+
+#include "test_common.h"
+
+static const uint32_t kSets  = 400u;
+static const uint32_t kTicks = 3000u;
+
+struct RefIntegrator {
+    uint32_t acc, max, on, off, up, down;
+    bool     level;
+
+    // Returns 1 on a press, 2 on a release
+    unsigned step(bool raw)
+    {
+        if (raw) acc = (max - acc > up) ? acc + up : max;
+        else     acc = (acc > down) ? acc - down : 0u;
+
+        if (!level && acc >= on)  { level = true;  return 1u; }
+        if (level && acc <= off)  { level = false; return 2u; }
+        return 0u;
+    }
+};
+
+int main()
+{
+    const uint32_t range = (uint32_t)(ButtonDebounce::IntegValue)~0u;
+    TestRng rng(44u);
+
+    for (uint32_t s = 0; s < kSets; s++) {
+        // Small ranges half the time, anything up to the type's limit otherwise
+        const uint32_t max = 1u + rng.below(rng.chance(500u) ? 16u : range);
+        RefIntegrator ref;
+        ref.max  = max;
+        ref.on   = 1u + rng.below(max);
+        ref.off  = rng.below(ref.on);
+        // Keep a full swing within ~1..60 samples, sometimes one huge step
+        ref.up   = rng.chance(50u) ? range : 1u + max / (1u + rng.below(60u));
+        ref.down = rng.chance(50u) ? range : 1u + max / (1u + rng.below(60u));
+        ref.up   = ref.up > range ? range : ref.up;
+        ref.down = ref.down > range ? range : ref.down;
+
+        ButtonDebounce::Config cfg;
+        cfg.integ_max  = (ButtonDebounce::IntegValue)ref.max;
+        cfg.integ_on   = (ButtonDebounce::IntegValue)ref.on;
+        cfg.integ_off  = (ButtonDebounce::IntegValue)ref.off;
+        cfg.integ_up   = (ButtonDebounce::IntegValue)ref.up;
+        cfg.integ_down = (ButtonDebounce::IntegValue)ref.down;
+
+        const bool start = (s & 1u) != 0u;
+        ButtonDebounce btn(cfg);
+        btn.reset(start);
+        ref.level = start;
+        ref.acc = start ? max : 0u;
+
+        TestLine line((uint16_t)(s % 50u));
+        for (uint32_t t = 0; t < kTicks; t++) {
+            const bool raw = line.next(rng);
+            btn.update(raw);
+            const unsigned ev = ref.step(raw);
+            const bool railed = ref.acc == 0u || ref.acc == ref.max;
+
+            TEST_CHECK(btn.down() == ref.level && btn.pressed() == (ev == 1u) &&
+                       btn.released() == (ev == 2u) && btn.settled() == (ev == 0u && railed),
+                       "set %lu (max %lu on %lu off %lu up %lu down %lu) tick %lu: level %d/%d event %u",
+                       (unsigned long)s, (unsigned long)ref.max, (unsigned long)ref.on,
+                       (unsigned long)ref.off, (unsigned long)ref.up, (unsigned long)ref.down,
+                       (unsigned long)t, (int)btn.down(), (int)ref.level, ev);
+        }
+    }
+    return testResult("test_integrator " TEST_ENGINE_NAME);
+}
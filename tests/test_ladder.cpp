@@ -0,0 +1,99 @@
+/**
+ * ButtonDebounce - Analog Ladder Test
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * AnalogLadder<K> on scripted ADC samples:
+ * - decode(): inclusive key windows, kNone between and outside them
+ * - a key is accepted on exactly the ladder_n-th matching sample
+ * - a direct key-to-key change reports the release and the press on the
+ *   same tick
+ * - samples between windows release the key after ladder_n samples
+ * - a candidate that flickers restarts its count
+ */
+
+#include "test_common.h"
+#include "ButtonDebounceAnalog.h"
+
+typedef AnalogLadder<3> Ladder;
+
+static const Ladder::Key kKeys[3] = {
+    { 100u, 199u },
+    { 300u, 399u },
+    { 600u, 699u },
+};
+
+static const uint16_t kGap = 250u;   // between key 0 and key 1
+
+// Feeds one sample and checks the three masks
+static void expect(Ladder& l, uint16_t sample, uint32_t down, uint32_t pressed, uint32_t released,
+                   const char* what, unsigned n)
+{
+    l.update(sample);
+    TEST_CHECK(l.down() == down && l.pressed() == pressed && l.released() == released,
+               "%s (ladder_n %u, sample %u): down %lx/%lx pressed %lx/%lx released %lx/%lx",
+               what, n, (unsigned)sample, (unsigned long)l.down(), (unsigned long)down,
+               (unsigned long)l.pressed(), (unsigned long)pressed,
+               (unsigned long)l.released(), (unsigned long)released);
+}
+
+static void testDecode()
+{
+    Ladder l(kKeys);
+    TEST_CHECK(l.decode(100u) == 0u && l.decode(199u) == 0u, "key 0 window edges");
+    TEST_CHECK(l.decode(300u) == 1u && l.decode(399u) == 1u, "key 1 window edges");
+    TEST_CHECK(l.decode(699u) == 2u, "key 2 upper edge");
+    TEST_CHECK(l.decode(99u) == Ladder::kNone && l.decode(200u) == Ladder::kNone &&
+               l.decode(kGap) == Ladder::kNone && l.decode(700u) == Ladder::kNone &&
+               l.decode(0u) == Ladder::kNone && l.decode(0xFFFFu) == Ladder::kNone,
+               "samples outside every window");
+}
+
+static void testSequence(uint8_t n)
+{
+    Ladder::Config cfg;
+    cfg.ladder_n = n;
+    Ladder l(kKeys, cfg);
+
+    // Acceptance on exactly the n-th matching sample, then quiet
+    for (unsigned i = 1u; i < n; i++) expect(l, 150u, 0u, 0u, 0u, "key 0 before ladder_n", n);
+    expect(l, 150u, 1u, 1u, 0u, "key 0 accepted", n);
+    TEST_CHECK(l.key() == 0u, "key() after accepting key 0");
+    for (unsigned i = 0u; i < 5u; i++) expect(l, 120u, 1u, 0u, 0u, "key 0 held", n);
+
+    // Key to key: release and press on the same tick
+    for (unsigned i = 1u; i < n; i++) expect(l, 350u, 1u, 0u, 0u, "key 1 before ladder_n", n);
+    expect(l, 350u, 2u, 2u, 1u, "key 0 -> key 1", n);
+
+    // Between windows: kNone is accepted like a key, releasing key 1
+    for (unsigned i = 1u; i < n; i++) expect(l, kGap, 2u, 0u, 0u, "gap before ladder_n", n);
+    expect(l, kGap, 0u, 0u, 2u, "gap releases key 1", n);
+    TEST_CHECK(l.key() == Ladder::kNone, "key() after the gap");
+    expect(l, 800u, 0u, 0u, 0u, "out of range", n);
+
+    // A flickering candidate restarts its count
+    if (n >= 2u) {
+        for (unsigned i = 1u; i < n; i++) expect(l, 650u, 0u, 0u, 0u, "key 2 before flicker", n);
+        expect(l, kGap, 0u, 0u, 0u, "flicker", n);
+        for (unsigned i = 1u; i < n; i++) expect(l, 650u, 0u, 0u, 0u, "key 2 count restarted", n);
+        expect(l, 650u, 4u, 4u, 0u, "key 2 accepted after flicker", n);
+
+        // Flicker between two keys never gets either accepted
+        for (unsigned i = 0u; i < 20u; i++) {
+            expect(l, (i & 1u) ? 150u : 350u, 4u, 0u, 0u, "alternating keys", n);
+        }
+    }
+
+    l.reset();
+    TEST_CHECK(l.key() == Ladder::kNone && l.down() == 0u && l.pressed() == 0u, "reset");
+}
+
+int main()
+{
+    testDecode();
+    const uint8_t kN[] = { 1u, 2u, 3u, 5u };
+    for (size_t i = 0; i < sizeof(kN); i++) testSequence(kN[i]);
+    return testResult("test_ladder");
+}
@@ -0,0 +1,65 @@
+/**
+ * ButtonDebounce - Pattern Parser Test
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * ButtonDebounce::pattern() is checked entirely at compile time:
+ * - the normal build static_asserts the masks of well-formed strings
+ * - with TEST_PATTERN_REJECT set, it builds one malformed rule; CMake
+ *   adds these as tests that pass only if the build fails
+ *     1: unknown character, 2: '-' (not a don't-care character),
+ *     3: one position more than BUTTON_DEBOUNCE_PATTERN_BITS
+ */
+
+#include "ButtonDebounce.h"
+
+typedef ButtonDebounce::Pattern     Pattern;
+typedef ButtonDebounce::PatternBits PatternBits;
+
+// As many '1' as the history holds
+#define TEST_P8  "11111111"
+#define TEST_P16 TEST_P8 TEST_P8
+#define TEST_P32 TEST_P16 TEST_P16
+#define TEST_P64 TEST_P32 TEST_P32
+#if !defined(BUTTON_DEBOUNCE_PATTERN_BITS) || BUTTON_DEBOUNCE_PATTERN_BITS == 8
+#define TEST_FULL TEST_P8
+#elif BUTTON_DEBOUNCE_PATTERN_BITS == 16
+#define TEST_FULL TEST_P16
+#elif BUTTON_DEBOUNCE_PATTERN_BITS == 32
+#define TEST_FULL TEST_P32
+#else
+#define TEST_FULL TEST_P64
+#endif
+
+#if !defined(TEST_PATTERN_REJECT)
+
+constexpr bool same(Pattern p, unsigned long long care, unsigned long long match)
+{
+    return p.care == (PatternBits)care && p.match == (PatternBits)match;
+}
+
+static_assert(same(ButtonDebounce::pattern("00xxx111"), 0xC7u, 0x07u), "default press rule");
+static_assert(same(ButtonDebounce::pattern("11xxx000"), 0xC7u, 0xC0u), "default release rule");
+static_assert(same(ButtonDebounce::pattern("00_xxx_111"), 0xC7u, 0x07u), "'_' is ignored");
+static_assert(same(ButtonDebounce::pattern("1"), 0x01u, 0x01u), "newest sample is the LSB");
+static_assert(same(ButtonDebounce::pattern("10"), 0x03u, 0x02u), "oldest sample first");
+static_assert(same(ButtonDebounce::pattern("x"), 0x00u, 0x00u), "don't care");
+static_assert(same(ButtonDebounce::pattern(""), 0x00u, 0x00u), "empty rule");
+static_assert(same(ButtonDebounce::pattern(TEST_FULL), ~0ull, ~0ull), "full history width");
+static_assert(same(ButtonDebounce::pattern("_" TEST_FULL "_"), ~0ull, ~0ull),
+              "separators do not count toward the width");
+
+#elif TEST_PATTERN_REJECT == 1
+constexpr Pattern kBad = ButtonDebounce::pattern("00y111");
+#elif TEST_PATTERN_REJECT == 2
+constexpr Pattern kBad = ButtonDebounce::pattern("00--111");
+#elif TEST_PATTERN_REJECT == 3
+constexpr Pattern kBad = ButtonDebounce::pattern("1" TEST_FULL);
+#endif
+
+int main()
+{
+    return 0;
+}
@@ -0,0 +1,142 @@
+/**
+ * ButtonDebounce - Save/Restore Round Trip Test
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * For the engine this binary is linked against and every test Config:
+ * - a ButtonDebounce saved mid-stream and restored into a fresh instance
+ *   continues exactly like the original
+ * - restore() rejects a blob from another engine or layout version and
+ *   leaves the target unchanged
+ * - a ButtonBank saved mid-stream and restored into a fresh dense or
+ *   sparse bank continues exactly like the original
+ */
+
+#include "test_common.h"
+#include "ButtonDebounceBank.h"
+#include <memory>
+#include <string.h>
+
+static const size_t   kN     = 40u;
+static const size_t   kWords = ButtonBank<kN>::kWords;
+static const uint32_t kTicks = 3000u;
+
+static bool sameButton(const ButtonDebounce& a, const ButtonDebounce& b)
+{
+    return a.down() == b.down() && a.pressed() == b.pressed() && a.released() == b.released() &&
+           a.history() == b.history() && a.settled() == b.settled() &&
+           a.pressCount() == b.pressCount() && a.releaseCount() == b.releaseCount();
+}
+
+static void testSingle(size_t c)
+{
+    const ButtonDebounce::Config cfg = testConfig(c);
+
+    for (uint32_t split = 1u; split < kTicks; split += 397u) {
+        TestRng rng(77u + split);
+        TestLine line(20u);
+        ButtonDebounce a(cfg);
+
+        uint32_t t = 0u;
+        for (; t < split; t++) {
+            a.update(line.next(rng));
+            if (cfg.latch_events) testConsume(a, testConsumeMask(t, 0u));
+        }
+
+        ButtonDebounce::SavedState s;
+        a.save(s);
+        TEST_CHECK(s.version == ButtonDebounce::kSaveVersion && s.engine == ButtonDebounce::engineId(),
+                   "cfg %u: header %u/%u", (unsigned)c, (unsigned)s.version, (unsigned)s.engine);
+
+        // Mismatched blobs are rejected and change nothing
+        ButtonDebounce b(cfg);
+        ButtonDebounce::SavedState before, after, bad = s;
+        b.save(before);
+        bad.engine = (uint8_t)(s.engine + 1u);
+        TEST_CHECK(!b.restore(bad), "cfg %u: foreign engine accepted", (unsigned)c);
+        bad = s;
+        bad.version = (uint8_t)(s.version + 1u);
+        TEST_CHECK(!b.restore(bad), "cfg %u: foreign version accepted", (unsigned)c);
+        b.save(after);
+        TEST_CHECK(memcmp(&before, &after, sizeof(before)) == 0, "cfg %u: rejected restore wrote state",
+                   (unsigned)c);
+
+        TEST_CHECK(b.restore(s), "cfg %u: own blob rejected", (unsigned)c);
+        TEST_CHECK(sameButton(a, b), "cfg %u split %lu: differs right after restore",
+                   (unsigned)c, (unsigned long)split);
+
+        for (; t < split + 500u; t++) {
+            const bool raw = line.next(rng);
+            a.update(raw);
+            b.update(raw);
+            if (cfg.latch_events) {
+                testConsume(a, testConsumeMask(t, 0u));
+                testConsume(b, testConsumeMask(t, 0u));
+            }
+            TEST_CHECK(sameButton(a, b), "cfg %u split %lu tick %lu: differs after restore",
+                       (unsigned)c, (unsigned long)split, (unsigned long)t);
+        }
+    }
+}
+
+static void testBank(size_t c)
+{
+    const ButtonDebounce::Config cfg = testConfig(c);
+
+    std::unique_ptr<ButtonBank<kN> > pa(new ButtonBank<kN>(cfg));
+    std::unique_ptr<ButtonBank<kN> > pb(new ButtonBank<kN>(cfg));
+    std::unique_ptr<ButtonBank<kN> > ps(new ButtonBank<kN>(cfg));
+    ButtonBank<kN>& a = *pa;
+    ButtonBank<kN>& b = *pb;
+    ButtonBank<kN>& s = *ps;
+    static ButtonBank<kN>::SavedState blob;
+    s.setSkipSettled(true);
+
+    TestRng rng(99u + (uint32_t)c);
+    TestLine line[kN];
+    const uint32_t split = kTicks / 2u;
+
+    for (uint32_t t = 0; t < kTicks; t++) {
+        if (t == split) {
+            a.save(blob);
+            TEST_CHECK(b.restore(blob) && s.restore(blob), "cfg %u: bank blob rejected", (unsigned)c);
+        }
+
+        uint32_t raw[kWords] = { 0u };
+        for (size_t i = 0; i < kN; i++) {
+            if (line[i].next(rng)) raw[i >> 5] |= 1u << (i & 31u);
+        }
+        a.update(raw);
+        if (t < split) continue;
+
+        b.update(raw);
+        s.update(raw);
+
+        ButtonBank<kN>::Snapshot sa, sb, ss;
+        a.snapshot(sa);
+        b.snapshot(sb);
+        s.snapshot(ss);
+        TEST_CHECK(sa.tick == sb.tick && sa.tick == ss.tick, "cfg %u tick %lu: tick %lu/%lu/%lu",
+                   (unsigned)c, (unsigned long)t, (unsigned long)sa.tick, (unsigned long)sb.tick,
+                   (unsigned long)ss.tick);
+        TEST_CHECK(memcmp(sa.down, sb.down, sizeof(sa.down)) == 0 &&
+                   memcmp(sa.pressed, sb.pressed, sizeof(sa.pressed)) == 0 &&
+                   memcmp(sa.released, sb.released, sizeof(sa.released)) == 0,
+                   "cfg %u tick %lu: restored bank differs", (unsigned)c, (unsigned long)t);
+        TEST_CHECK(memcmp(sa.down, ss.down, sizeof(sa.down)) == 0 &&
+                   memcmp(sa.pressed, ss.pressed, sizeof(sa.pressed)) == 0 &&
+                   memcmp(sa.released, ss.released, sizeof(sa.released)) == 0,
+                   "cfg %u tick %lu: restored sparse bank differs", (unsigned)c, (unsigned long)t);
+    }
+}
+
+int main()
+{
+    for (size_t c = 0; c < kTestConfigs; c++) {
+        testSingle(c);
+        testBank(c);
+    }
+    return testResult("test_save_restore " TEST_ENGINE_NAME);
+}
@@ -0,0 +1,133 @@
+/**
+ * ButtonDebounce - SPDT Test
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * SpdtBank<N> against one SpdtDebounce per lane on a model of changeover
+ * switches: travel with both contacts open, bounce on the throw just
+ * reached, and stuck-closed faults from a few ticks to longer than the
+ * 8-bit fault counter. Level, events, fault and faultRaised must match on
+ * every tick for several fault_ticks settings; every other tick goes
+ * through updateActiveLow() and the port words carry junk above lane N.
+ */
+
+#include "test_common.h"
+#include "ButtonDebounceSpdt.h"
+
+static const size_t   kN     = 70u;
+static const size_t   kWords = SpdtBank<kN>::kWords;
+static const uint32_t kTicks = 20000u;
+
+// One changeover switch: the contact rests on NO or NC, travels with both
+// open, bounces on arrival, and now and then both read closed
+struct SpdtLine {
+    bool     on_no;
+    uint16_t hold;
+    uint8_t  travel;
+    uint8_t  bounce;
+    uint16_t stuck;
+
+    SpdtLine() : on_no(false), hold(0u), travel(0u), bounce(0u), stuck(0u) {}
+
+    void next(TestRng& rng, bool& no, bool& nc)
+    {
+        if (stuck != 0u) {
+            stuck--;
+            no = nc = true;
+            return;
+        }
+        if (hold == 0u) {
+            on_no = !on_no;
+            hold = (uint16_t)(10u + rng.below(80u));
+            travel = (uint8_t)(1u + rng.below(4u));
+            bounce = (uint8_t)rng.below(8u);
+            if (rng.chance(60u)) stuck = (uint16_t)(1u + (rng.chance(100u) ? 250u + rng.below(80u) : rng.below(12u)));
+        }
+        hold--;
+
+        no = nc = false;
+        if (travel != 0u) {
+            travel--;
+            return;
+        }
+        const bool closed = bounce != 0u ? (rng.next() & 1u) != 0u : true;
+        if (bounce != 0u) bounce--;
+        (on_no ? no : nc) = closed;
+    }
+};
+
+static void run(uint8_t fault_ticks)
+{
+    SpdtDebounce::Config cfg;
+    cfg.fault_ticks = fault_ticks;
+
+    static SpdtDebounce single[kN];
+    for (size_t i = 0; i < kN; i++) single[i] = SpdtDebounce(cfg);
+    static SpdtBank<kN> bank;
+    bank = SpdtBank<kN>(cfg);
+
+    TestRng rng(48u + fault_ticks);
+    SpdtLine line[kN];
+    uint32_t faults = 0u, presses = 0u;
+
+    for (uint32_t t = 0; t < kTicks; t++) {
+        uint32_t no[kWords] = { 0u }, nc[kWords] = { 0u };
+        uint32_t dn[kWords] = { 0u }, pr[kWords] = { 0u }, rl[kWords] = { 0u };
+        uint32_t ft[kWords] = { 0u }, fr[kWords] = { 0u };
+
+        for (size_t i = 0; i < kN; i++) {
+            bool a, b;
+            line[i].next(rng, a, b);
+            const uint32_t bit = 1u << (i & 31u);
+            if (a) no[i >> 5] |= bit;
+            if (b) nc[i >> 5] |= bit;
+
+            single[i].update(a, b);
+            if (single[i].down())        dn[i >> 5] |= bit;
+            if (single[i].pressed())     pr[i >> 5] |= bit;
+            if (single[i].released())    rl[i >> 5] |= bit;
+            if (single[i].fault())       ft[i >> 5] |= bit;
+            if (single[i].faultRaised()) fr[i >> 5] |= bit;
+            faults += single[i].faultRaised() ? 1u : 0u;
+            presses += single[i].pressed() ? 1u : 0u;
+        }
+        const uint32_t junk = ~((1u << (kN & 31u)) - 1u);
+        no[kWords - 1u] |= rng.next() & junk;
+        nc[kWords - 1u] |= rng.next() & junk;
+
+        if (t & 1u) {
+            uint32_t no_port[kWords], nc_port[kWords];
+            for (size_t w = 0; w < kWords; w++) {
+                no_port[w] = ~no[w];
+                nc_port[w] = ~nc[w];
+            }
+            bank.updateActiveLow(no_port, nc_port);
+        } else {
+            bank.update(no, nc);
+        }
+
+        for (size_t w = 0; w < kWords; w++) {
+            TEST_CHECK(bank.downMask()[w] == dn[w] && bank.pressedMask()[w] == pr[w] &&
+                       bank.releasedMask()[w] == rl[w] && bank.faultMask()[w] == ft[w] &&
+                       bank.faultRaisedMask()[w] == fr[w],
+                       "fault_ticks %u tick %lu word %u: down %08lx/%08lx fault %08lx/%08lx raised %08lx/%08lx",
+                       (unsigned)fault_ticks, (unsigned long)t, (unsigned)w,
+                       (unsigned long)bank.downMask()[w], (unsigned long)dn[w],
+                       (unsigned long)bank.faultMask()[w], (unsigned long)ft[w],
+                       (unsigned long)bank.faultRaisedMask()[w], (unsigned long)fr[w]);
+        }
+    }
+
+    TEST_CHECK(presses != 0u, "fault_ticks %u: no presses", (unsigned)fault_ticks);
+    TEST_CHECK((faults != 0u) == (fault_ticks != 0u), "fault_ticks %u: %lu faults",
+               (unsigned)fault_ticks, (unsigned long)faults);
+}
+
+int main()
+{
+    const uint8_t kFaultTicks[] = { 4u, 0u, 1u, 12u, 255u };
+    for (size_t i = 0; i < sizeof(kFaultTicks); i++) run(kFaultTicks[i]);
+    return testResult("test_spdt");
+}
@@ -0,0 +1,160 @@
+/**
+ * ButtonDebounce - Speculative Press Test
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * SpeculativePress on top of the engine this binary is linked against,
+ * for every test Config and several cancel_ticks, on bouncing lines.
+ * Every tick is checked against the documented rules:
+ * - TentativePress only on a raw press edge, level up, nothing pending
+ * - Confirm exactly on the ticks the engine's level goes down
+ * - Cancel only for a pending press, once the engine is at rest with the
+ *   level up (whatever latched events are pending) or cancel_ticks have
+ *   passed, and never later than that
+ * - every Confirm / Cancel after a TentativePress closes it; stats()
+ *   agree with the events seen
+ *
+ * A latched case leaves a release unconsumed, then sends a glitch: it
+ * must be cancelled as soon as the engine is at rest again, not held
+ * pending until the next real press.
+ */
+
+#include "test_common.h"
+#include "ButtonDebounceSpeculative.h"
+
+static const uint32_t kTicks = 20000u;
+static const uint32_t kLines = 6u;
+
+static uint32_t g_presses = 0u;
+
+static void run(size_t c, uint8_t cancel_ticks)
+{
+    const ButtonDebounce::Config cfg = testConfig(c);
+    SpeculativePress::Config scfg;
+    scfg.cancel_ticks = cancel_ticks;
+
+    for (uint32_t l = 0; l < kLines; l++) {
+        TestRng rng(49u + l * 7u + (uint32_t)c);
+        TestLine line((uint16_t)(l * 8u));
+        ButtonDebounce btn(cfg);
+        SpeculativePress spec(scfg);
+
+        bool prev_raw = false, was_down = false, pending = false;
+        uint32_t wait = 0u;
+        uint32_t tentative = 0u, confirmed = 0u, cancelled = 0u, rises = 0u;
+
+        for (uint32_t t = 0; t < kTicks; t++) {
+            const bool raw = line.next(rng);
+            btn.update(raw);
+            const SpeculativePress::Event ev = spec.update(raw, btn);
+
+            const bool rose = btn.down() && !was_down;
+            const bool edge = raw && !prev_raw;
+            if (pending) wait++;
+            rises += rose ? 1u : 0u;
+            const bool give_up = (btn.up() && !btn.debouncing()) ||
+                                 (cancel_ticks != 0u && wait >= cancel_ticks);
+
+            switch (ev) {
+            case SpeculativePress::TentativePress:
+                TEST_CHECK(edge && btn.up() && !pending, "cfg %u line %lu tick %lu: stray TentativePress",
+                           (unsigned)c, (unsigned long)l, (unsigned long)t);
+                pending = true;
+                wait = 0u;
+                tentative++;
+                break;
+            case SpeculativePress::Confirm:
+                TEST_CHECK(rose, "cfg %u line %lu tick %lu: Confirm without a press",
+                           (unsigned)c, (unsigned long)l, (unsigned long)t);
+                if (!pending) tentative++;   // accepted on the first edge
+                pending = false;
+                confirmed++;
+                break;
+            case SpeculativePress::Cancel:
+                TEST_CHECK(pending && !rose && give_up,
+                           "cfg %u line %lu tick %lu: Cancel (pending %d wait %lu debouncing %d)",
+                           (unsigned)c, (unsigned long)l, (unsigned long)t, (int)pending,
+                           (unsigned long)wait, (int)btn.debouncing());
+                pending = false;
+                cancelled++;
+                break;
+            default:
+                TEST_CHECK(!rose, "cfg %u line %lu tick %lu: engine press without Confirm",
+                           (unsigned)c, (unsigned long)l, (unsigned long)t);
+                TEST_CHECK(!(pending && give_up),
+                           "cfg %u line %lu tick %lu: missed Cancel", (unsigned)c, (unsigned long)l,
+                           (unsigned long)t);
+                break;
+            }
+            TEST_CHECK(spec.pending() == pending, "cfg %u line %lu tick %lu: pending %d/%d",
+                       (unsigned)c, (unsigned long)l, (unsigned long)t, (int)spec.pending(), (int)pending);
+
+            prev_raw = raw;
+            was_down = btn.down();
+            if (cfg.latch_events) testConsume(btn, testConsumeMask(t, l));
+        }
+
+        const SpeculativePress::Stats& s = spec.stats();
+        TEST_CHECK(s.tentative == tentative && s.confirmed == confirmed && s.cancelled == cancelled,
+                   "cfg %u line %lu: stats %lu/%lu/%lu, seen %lu/%lu/%lu", (unsigned)c, (unsigned long)l,
+                   (unsigned long)s.tentative, (unsigned long)s.confirmed, (unsigned long)s.cancelled,
+                   (unsigned long)tentative, (unsigned long)confirmed, (unsigned long)cancelled);
+        TEST_CHECK(tentative == confirmed + cancelled + (pending ? 1u : 0u),
+                   "cfg %u line %lu: %lu tentative, %lu confirmed, %lu cancelled", (unsigned)c,
+                   (unsigned long)l, (unsigned long)tentative, (unsigned long)confirmed,
+                   (unsigned long)cancelled);
+        TEST_CHECK(confirmed == rises, "cfg %u line %lu: %lu presses, %lu confirms",
+                   (unsigned)c, (unsigned long)l, (unsigned long)rises, (unsigned long)confirmed);
+        g_presses += rises;
+    }
+}
+
+// Latched events: press and release, consume only the press, then a
+// one-tick glitch. The pending release must not hold the Cancel off.
+static void testLatchedGlitch()
+{
+    ButtonDebounce::Config cfg;
+    cfg.latch_events = true;
+    ButtonDebounce btn(cfg);
+    SpeculativePress spec;
+
+    unsigned tentative = 0u, confirmed = 0u, cancelled = 0u;
+    int cancel_tick = -1;
+    for (int t = 0; t < 300; t++) {
+        const bool raw = (t >= 10 && t < 70) || t == 150;   // hold, release, glitch
+        btn.update(raw);
+        const SpeculativePress::Event ev = spec.update(raw, btn);
+        if (t == 100) btn.consumePressed();                // the release stays pending
+
+        if (ev == SpeculativePress::TentativePress) tentative++;
+        if (ev == SpeculativePress::Confirm) confirmed++;
+        if (ev == SpeculativePress::Cancel) {
+            cancelled++;
+            if (cancel_tick < 0) cancel_tick = t;
+        }
+        if (t == 150) TEST_CHECK(spec.pending(), "glitch not speculated on");
+        if (t > 150 && spec.pending()) {
+            TEST_CHECK(btn.debouncing(), "tick %d: engine at rest, press still pending", t);
+        }
+    }
+
+    TEST_CHECK(btn.releaseCount() == 1u, "release consumed (%u pending)", (unsigned)btn.releaseCount());
+    TEST_CHECK(tentative == 2u && confirmed == 1u && cancelled == 1u && cancel_tick > 150,
+               "latched glitch: %u tentative, %u confirmed, %u cancelled (tick %d)",
+               tentative, confirmed, cancelled, cancel_tick);
+    TEST_CHECK(!spec.pending(), "latched glitch still pending at the end");
+}
+
+int main()
+{
+    testLatchedGlitch();
+
+    const uint8_t kCancelTicks[] = { 0u, 1u, 5u, 40u };
+    for (size_t c = 0; c < kTestConfigs; c++) {
+        for (size_t i = 0; i < sizeof(kCancelTicks); i++) run(c, kCancelTicks[i]);
+    }
+    TEST_CHECK(g_presses != 0u, "the engine never pressed");
+    return testResult("test_speculative " TEST_ENGINE_NAME);
+}
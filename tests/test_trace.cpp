@@ -0,0 +1,68 @@
+/**
+ * ButtonDebounce - Engine Trace
+ *
+ * Copyright (c) 2025 M&E Design
+ * Written by Michael Garcia <michael@mandedesign.studio>
+ * Version: 1.0.0
+ *
+ * Runs the engine this binary is linked against over a fixed set of
+ * bouncing lines for every test Config and prints one checksum per
+ * Config (level, events, pending counts, history and settled() on every
+ * tick). CMake builds it per engine in the default, constant-time and
+ * header-only forms, and the tests compare their output: the builds must
+ * produce identical traces.
+ */
+
+#include "test_common.h"
+
+#ifndef TEST_ENGINE_NAME
+#define TEST_ENGINE_NAME "unknown"
+#endif
+
+static const uint32_t kTicks = 20000u;
+static const uint32_t kLines = 8u;
+
+static uint32_t fnv(uint32_t h, uint32_t v)
+{
+    for (unsigned i = 0; i < 4u; i++) {
+        h ^= (v >> (8u * i)) & 0xFFu;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+int main()
+{
+    printf("engine: %s (id %u)\n", TEST_ENGINE_NAME, (unsigned)ButtonDebounce::engineId());
+
+    for (size_t c = 0; c < kTestConfigs; c++) {
+        const ButtonDebounce::Config cfg = testConfig(c);
+        uint32_t h = 2166136261u;
+        uint32_t events = 0u;
+
+        for (uint32_t l = 0; l < kLines; l++) {
+            TestRng rng(0x9E3779B9u * (l + 1u));
+            TestLine line((uint16_t)(5u * l));
+            ButtonDebounce btn(cfg);
+            btn.reset((l & 1u) != 0u);
+
+            for (uint32_t t = 0; t < kTicks; t++) {
+                btn.update(line.next(rng));
+                if (cfg.latch_events) testConsume(btn, testConsumeMask(t, l));
+
+                const uint32_t v = (uint32_t)btn.down()
+                                 | (uint32_t)btn.pressed() << 1
+                                 | (uint32_t)btn.released() << 2
+                                 | (uint32_t)btn.settled() << 3
+                                 | (uint32_t)btn.history() << 8
+                                 | (uint32_t)btn.pressCount() << 16
+                                 | (uint32_t)btn.releaseCount() << 24;
+                h = fnv(h, v);
+                events += btn.pressed() ? 1u : 0u;
+            }
+        }
+        printf("cfg %u: events %lu trace %08lx\n", (unsigned)c,
+               (unsigned long)events, (unsigned long)h);
+    }
+    return 0;
+}